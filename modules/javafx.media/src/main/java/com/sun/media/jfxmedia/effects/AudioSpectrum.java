@@ -83,6 +83,22 @@ public interface AudioSpectrum {
      */
     public void setSensitivityThreshold(int threshold);
 
+    /**
+     * Returns whether phases are computed along with magnitudes.
+     *
+     * @return boolean value
+     */
+    public boolean getPhasesEnabled();
+
+    /**
+     * Turns on or off phase computation. When disabled only magnitudes are
+     * updated and {@link #getPhases(float[]) getPhases(float[])} keeps
+     * returning the last values computed while phases were enabled.
+     *
+     * @param enabled boolean value
+     */
+    public void setPhasesEnabled(boolean enabled);
+
     /**
      * Returns an array of the last available magnitudes. The size of the array equals
      * the number of bands set by the {@link #setBandCount(int) setBandCount(int)} method.
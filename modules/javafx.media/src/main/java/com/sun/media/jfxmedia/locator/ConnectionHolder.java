@@ -38,6 +38,8 @@ import java.nio.channels.Channels;
 import java.nio.channels.ClosedChannelException;
 import java.nio.channels.FileChannel;
 import java.nio.channels.ReadableByteChannel;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
 import java.util.Map;
 
 /**
@@ -46,9 +48,16 @@ import java.util.Map;
  */
 public abstract class ConnectionHolder {
     private static int DEFAULT_BUFFER_SIZE = 4096;
+    private static final int MAX_BLOCK_RING_DEPTH = 32;
+
+    // Number of blocks which may be read ahead directly into the native block ring,
+    // 0 to copy every block through buffer, e.g., -Djfxmedia.blockRingDepth=8
+    private static final int blockRingDepth = AccessController.doPrivileged(
+            (PrivilegedAction<Integer>) () -> Integer.getInteger("jfxmedia.blockRingDepth", 0));
 
     ReadableByteChannel channel;
     ByteBuffer          buffer = ByteBuffer.allocateDirect(DEFAULT_BUFFER_SIZE);
+    private ByteBuffer[] blockRing;
 
     static ConnectionHolder createMemoryConnectionHolder(ByteBuffer buffer) {
         return new MemoryConnectionHolder(buffer);
@@ -80,11 +89,71 @@ public abstract class ConnectionHolder {
         if (buffer.limit() < buffer.capacity()) {
             buffer.limit(buffer.capacity());
         }
+        return readNextBlock(buffer);
+    }
+
+    /**
+     * Reads a block of data from the current position of the opened stream
+     * directly into a slot of the block ring registered by the native source.
+     *
+     * @return The number of bytes read, possibly zero, or -1 if the channel
+     * has reached end-of-stream.
+     *
+     * @throws ClosedChannelException if an attempt is made to read after
+     * closeConnection has been called
+     */
+    public int readNextBlock(int slot) throws IOException {
+        ByteBuffer[] ring = blockRing;
+        if (null == ring) {
+            throw new ClosedChannelException();
+        }
+        ByteBuffer slotBuffer = ring[slot];
+        slotBuffer.clear();
+        return readNextBlock(slotBuffer);
+    }
+
+    /**
+     * Reads available data from the current position of the opened stream
+     * into the given buffer.
+     */
+    int readNextBlock(ByteBuffer dst) throws IOException {
         // avoid NPE if channel does not exist or has been closed
         if (null == channel) {
             throw new ClosedChannelException();
         }
-        return channel.read(buffer);
+        return channel.read(dst);
+    }
+
+    /**
+     * Returns the number of blocks this holder wants to read ahead directly
+     * into native memory, or 0 if blocks should be copied from buffer.
+     * Random access holders work in pull mode and never use the ring.
+     */
+    int getBlockRingDepth() {
+        if (isRandomAccess()) {
+            return 0;
+        }
+        return Math.max(0, Math.min(blockRingDepth, MAX_BLOCK_RING_DEPTH));
+    }
+
+    /**
+     * Registers native memory to read blocks into. The ring is sliced
+     * into slots of slotSize bytes and stays valid until closeConnection.
+     *
+     * @return true if the ring is going to be used.
+     */
+    boolean registerBlockRing(ByteBuffer ring, int slotSize) {
+        if (ring == null || slotSize <= 0) {
+            return false;
+        }
+        int depth = ring.capacity() / slotSize;
+        ByteBuffer[] slots = new ByteBuffer[depth];
+        for (int i = 0; i < depth; i++) {
+            ring.limit((i + 1) * slotSize).position(i * slotSize);
+            slots[i] = ring.slice();
+        }
+        blockRing = slots;
+        return depth > 0;
     }
 
     public ByteBuffer getBuffer() {
@@ -136,6 +205,8 @@ public abstract class ConnectionHolder {
      * Overriding methods should call this method in the beginning of their implementation.
      */
     public void closeConnection() {
+        // native side frees the ring after the connection is closed
+        blockRing = null;
         try {
             if (channel != null) {
                 channel.close();
@@ -368,7 +439,7 @@ public abstract class ConnectionHolder {
                     }
 
                     int actual;
-                    if (bb.equals(buffer)) {
+                    if (bb == buffer) {
                         // we'll cheat here as we know that bb is buffer and rather
                         // than copy the data, just slice it like for readBlock
                         actual = Math.min(DEFAULT_BUFFER_SIZE, backingBuffer.remaining());
@@ -25,18 +25,33 @@
 package com.sun.media.jfxmedia.locator;
 
 import com.sun.media.jfxmedia.MediaError;
+import com.sun.media.jfxmedia.logging.Logger;
 import com.sun.media.jfxmediaimpl.MediaUtils;
 import java.io.BufferedReader;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.EOFException;
 import java.io.IOException;
+import java.io.InputStream;
 import java.io.InputStreamReader;
+import java.io.InterruptedIOException;
 import java.net.*;
+import java.nio.ByteBuffer;
 import java.nio.channels.Channels;
 import java.nio.channels.ReadableByteChannel;
 import java.nio.charset.Charset;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
 import java.util.ArrayList;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.concurrent.BlockingQueue;
 import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.concurrent.LinkedBlockingQueue;
 import java.util.concurrent.Semaphore;
 
@@ -52,6 +67,12 @@ final class HLSConnectionHolder extends ConnectionHolder {
     private boolean isPlaylistClosed = false;
     private boolean isBitrateAdjustable = false;
     private long startTime = -1;
+    private int segmentLength = 0;
+    private long segmentFetchTime = -1;
+    private final long createTime = System.currentTimeMillis();
+    private boolean isFirstSegmentLoaded = false;
+    private final SegmentPrefetcher prefetcher = (PREFETCH_SEGMENTS > 0) ?
+            new SegmentPrefetcher(PREFETCH_SEGMENTS, PREFETCH_CACHE_SIZE) : null;
     private static final long HLS_VALUE_FLOAT_MULTIPLIER = 1000;
     private static final int HLS_PROP_GET_DURATION = 1;
     private static final int HLS_PROP_GET_HLS_MODE = 2;
@@ -61,6 +82,24 @@ final class HLSConnectionHolder extends ConnectionHolder {
     private static final String CHARSET_UTF_8 = "UTF-8";
     private static final String CHARSET_US_ASCII = "US-ASCII";
 
+    // Number of segments downloaded in parallel ahead of the one being played,
+    // 0 to download segments one by one, e.g., -Djfxmedia.hls.prefetchSegments=3
+    private static final int PREFETCH_SEGMENTS;
+    // Upper bound in bytes for the segments which are downloaded but not played yet
+    private static final long PREFETCH_CACHE_SIZE;
+
+    static {
+        int[] segments = new int[1];
+        long[] cacheSize = new long[1];
+        AccessController.doPrivileged((PrivilegedAction) () -> {
+            segments[0] = Integer.getInteger("jfxmedia.hls.prefetchSegments", 0);
+            cacheSize[0] = Long.getLong("jfxmedia.hls.prefetchCacheSize", 16L * 1024 * 1024);
+            return null;
+        });
+        PREFETCH_SEGMENTS = Math.max(0, segments[0]);
+        PREFETCH_CACHE_SIZE = Math.max(0, cacheSize[0]);
+    }
+
     HLSConnectionHolder(URI uri) throws IOException {
         playlistThread.setPlaylistURI(uri);
         init();
@@ -72,12 +111,12 @@ final class HLSConnectionHolder extends ConnectionHolder {
     }
 
     @Override
-    public int readNextBlock() throws IOException {
+    int readNextBlock(ByteBuffer dst) throws IOException {
         if (isBitrateAdjustable && startTime == -1) {
             startTime = System.currentTimeMillis();
         }
 
-        int read = super.readNextBlock();
+        int read = super.readNextBlock(dst);
         if (isBitrateAdjustable && read == -1) {
             long readTime = System.currentTimeMillis() - startTime;
             startTime = -1;
@@ -118,6 +157,9 @@ final class HLSConnectionHolder extends ConnectionHolder {
         currentPlaylist.close();
         super.closeConnection();
         resetConnection();
+        if (prefetcher != null) {
+            prefetcher.close();
+        }
         playlistThread.putState(PlaylistThread.STATE_EXIT);
     }
 
@@ -169,18 +211,42 @@ final class HLSConnectionHolder extends ConnectionHolder {
             return -1;
         }
 
-        try {
-            URI uri = new URI(mediaFile);
-            urlConnection = uri.toURL().openConnection();
-            channel = openChannel();
-        } catch (Exception e) {
-            return -1;
+        Segment segment = (prefetcher != null) ? prefetcher.take(mediaFile) : null;
+        if (segment != null) {
+            channel = Channels.newChannel(new ByteArrayInputStream(segment.data));
+            segmentLength = segment.data.length;
+            segmentFetchTime = segment.fetchTime;
+        } else {
+            try {
+                URI uri = new URI(mediaFile);
+                urlConnection = uri.toURL().openConnection();
+                channel = openChannel();
+            } catch (Exception e) {
+                return -1;
+            }
+            segmentLength = urlConnection.getContentLength();
+            segmentFetchTime = -1;
+        }
+
+        if (prefetcher != null) {
+            // Keeps segments in playback order, drops the ones we moved away from
+            // because of seek or bitrate switch.
+            prefetcher.schedule(currentPlaylist.peekNextMediaFiles(PREFETCH_SEGMENTS));
+        }
+
+        if (!isFirstSegmentLoaded) {
+            isFirstSegmentLoaded = true;
+            if (Logger.canLog(Logger.DEBUG)) {
+                Logger.logMsg(Logger.DEBUG, "HLS time to first segment: "
+                        + (System.currentTimeMillis() - createTime) + " ms"
+                        + ((segment != null) ? " (prefetched)" : ""));
+            }
         }
 
         if (currentPlaylist.isCurrentMediaFileDiscontinuity()) {
-            return (-1 * urlConnection.getContentLength());
+            return (-1 * segmentLength);
         } else {
-            return urlConnection.getContentLength();
+            return segmentLength;
         }
     }
 
@@ -189,7 +255,11 @@ final class HLSConnectionHolder extends ConnectionHolder {
     }
 
     private void adjustBitrate(long readTime) {
-        int avgBitrate = (int)(((long) urlConnection.getContentLength() * 8 * 1000) / readTime);
+        // Prefetched segments are read from memory, so use actual download time for them
+        if (segmentFetchTime >= 0) {
+            readTime = segmentFetchTime;
+        }
+        int avgBitrate = (int)(((long) segmentLength * 8 * 1000) / Math.max(1, readTime));
 
         Playlist playlist = variantPlaylist.getPlaylistBasedOnBitrate(avgBitrate);
         if (playlist != null && playlist != currentPlaylist) {
@@ -794,6 +864,22 @@ final class HLSConnectionHolder extends ConnectionHolder {
             }
         }
 
+        // Returns up to count media files which follow the current one,
+        // without advancing the playlist.
+        private List<String> peekNextMediaFiles(int count) {
+            List<String> result = new ArrayList<String>(count);
+            synchronized (lock) {
+                for (int i = mediaFileIndex + 1; i < mediaFiles.size() && result.size() < count; i++) {
+                    if (baseURI != null) {
+                        result.add(baseURI + mediaFiles.get(i));
+                    } else {
+                        result.add(mediaFiles.get(i));
+                    }
+                }
+            }
+            return result;
+        }
+
         private double getDuration() {
             return duration;
         }
@@ -905,4 +991,176 @@ final class HLSConnectionHolder extends ConnectionHolder {
             needBaseURI = false;
         }
     }
+
+    private static final class Segment {
+
+        private final byte[] data;
+        private final long fetchTime;
+
+        private Segment(byte[] data, long fetchTime) {
+            this.data = data;
+            this.fetchTime = fetchTime;
+        }
+    }
+
+    // Downloads next segments in parallel while the current one is played.
+    // Segments are handed out by media file URI, so the order is defined by
+    // the playlist and not by download completion.
+    private static final class SegmentPrefetcher {
+
+        private static final int READ_SIZE = 65536;
+        private final ExecutorService executor;
+        private final long maxCacheSize;
+        private final Map<String, Prefetch> segments = new LinkedHashMap<String, Prefetch>();
+        // Size of the last downloaded segment, the estimate for segments
+        // whose size is not known yet
+        private volatile long lastSegmentSize = 0;
+
+        // A scheduled download and the bytes it holds against the cache size
+        private static final class Prefetch {
+            private volatile long reservedBytes;
+            private Future<Segment> future;
+
+            private Prefetch(long reservedBytes) {
+                this.reservedBytes = reservedBytes;
+            }
+        }
+
+        private SegmentPrefetcher(int threads, long maxCacheSize) {
+            this.maxCacheSize = maxCacheSize;
+            executor = Executors.newFixedThreadPool(threads, r -> {
+                Thread t = new Thread(r, "JFXMedia HLS Prefetch Thread");
+                t.setDaemon(true);
+                return t;
+            });
+        }
+
+        private synchronized void schedule(List<String> mediaFiles) {
+            Iterator<Map.Entry<String, Prefetch>> it = segments.entrySet().iterator();
+            while (it.hasNext()) {
+                Map.Entry<String, Prefetch> entry = it.next();
+                if (!mediaFiles.contains(entry.getKey())) {
+                    entry.getValue().future.cancel(true);
+                    it.remove();
+                }
+            }
+
+            long cacheSize = getCacheSize();
+            for (String mediaFile : mediaFiles) {
+                if (cacheSize >= maxCacheSize) {
+                    break;
+                }
+                if (!segments.containsKey(mediaFile)) {
+                    Prefetch prefetch = new Prefetch(lastSegmentSize);
+                    prefetch.future = executor.submit(() -> fetch(mediaFile, prefetch));
+                    segments.put(mediaFile, prefetch);
+                    cacheSize += prefetch.reservedBytes;
+                }
+            }
+        }
+
+        // Returns downloaded segment, waiting for it if download is in progress,
+        // or null if segment was not scheduled or failed to download. The
+        // download stays registered until it completes, so that close() can
+        // still cancel it.
+        private Segment take(String mediaFile) {
+            Prefetch prefetch;
+            synchronized (this) {
+                prefetch = segments.get(mediaFile);
+            }
+
+            if (prefetch == null) {
+                return null;
+            }
+
+            try {
+                return prefetch.future.get();
+            } catch (InterruptedException e) {
+                Thread.currentThread().interrupt();
+            } catch (Exception e) {
+            } finally {
+                synchronized (this) {
+                    segments.remove(mediaFile, prefetch);
+                }
+            }
+            return null;
+        }
+
+        private synchronized void close() {
+            for (Prefetch prefetch : segments.values()) {
+                prefetch.future.cancel(true);
+            }
+            segments.clear();
+            executor.shutdownNow();
+        }
+
+        // Downloaded bytes, and the bytes expected by downloads in progress
+        private long getCacheSize() {
+            long size = 0;
+            for (Prefetch prefetch : segments.values()) {
+                size += prefetch.reservedBytes;
+            }
+            return size;
+        }
+
+        private Segment fetch(String mediaFile, Prefetch prefetch)
+                throws IOException, URISyntaxException
+        {
+            boolean done = false;
+            try {
+                Segment segment = download(mediaFile, prefetch);
+                prefetch.reservedBytes = segment.data.length;
+                lastSegmentSize = segment.data.length;
+                done = true;
+                return segment;
+            } finally {
+                if (!done) {
+                    prefetch.reservedBytes = 0;
+                }
+            }
+        }
+
+        private static Segment download(String mediaFile, Prefetch prefetch)
+                throws IOException, URISyntaxException
+        {
+            long start = System.currentTimeMillis();
+            URLConnection connection = new URI(mediaFile).toURL().openConnection();
+            try (InputStream stream = connection.getInputStream()) {
+                byte[] data;
+                int length = connection.getContentLength();
+                if (length >= 0) {
+                    prefetch.reservedBytes = length;
+                    data = new byte[length];
+                    int offset = 0;
+                    while (offset < length) {
+                        int read = stream.read(data, offset, Math.min(READ_SIZE, length - offset));
+                        if (read < 0) {
+                            throw new EOFException();
+                        }
+                        offset += read;
+                        checkInterrupted();
+                    }
+                } else {
+                    ByteArrayOutputStream out = new ByteArrayOutputStream(READ_SIZE);
+                    byte[] buffer = new byte[READ_SIZE];
+                    int read;
+                    while ((read = stream.read(buffer)) != -1) {
+                        out.write(buffer, 0, read);
+                        prefetch.reservedBytes = Math.max(prefetch.reservedBytes, out.size());
+                        checkInterrupted();
+                    }
+                    data = out.toByteArray();
+                }
+                return new Segment(data, System.currentTimeMillis() - start);
+            } finally {
+                Locator.closeConnection(connection);
+            }
+        }
+
+        private static void checkInterrupted() throws InterruptedIOException {
+            if (Thread.currentThread().isInterrupted()) {
+                throw new InterruptedIOException();
+            }
+        }
+    }
 }
@@ -26,6 +26,8 @@
 package com.sun.media.jfxmediaimpl;
 
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
 
 final class NativeAudioSpectrum implements AudioSpectrum {
     private static final float[] EMPTY_FLOAT_ARRAY  = new float[0];
@@ -33,6 +35,15 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     public static final int      DEFAULT_BANDS = 128;
     public static final double   DEFAULT_INTERVAL = 0.1;
 
+    /**
+     * Whether phases are computed by default. Visualizers that only draw
+     * magnitudes can pass -Djfxmedia.spectrumPhases=false to skip the per band
+     * atan2() and the phase copy to Java.
+     */
+    private static final boolean DEFAULT_PHASES_ENABLED =
+            AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+                    !"false".equalsIgnoreCase(System.getProperty("jfxmedia.spectrumPhases")));
+
     /**
      * Handle to the native spectrum.
      */
@@ -56,6 +67,9 @@ final class NativeAudioSpectrum implements AudioSpectrum {
 
         this.nativeRef = refMedia;
         setBandCount(DEFAULT_BANDS);
+        if (!DEFAULT_PHASES_ENABLED) {
+            setPhasesEnabled(false);
+        }
     }
 
     //**************************************************************************
@@ -123,6 +137,16 @@ final class NativeAudioSpectrum implements AudioSpectrum {
         }
     }
 
+    @Override
+    public boolean getPhasesEnabled() {
+        return nativeGetPhasesEnabled(nativeRef);
+    }
+
+    @Override
+    public void setPhasesEnabled(boolean enabled) {
+        nativeSetPhasesEnabled(nativeRef, enabled);
+    }
+
     @Override
     public float[] getMagnitudes(float[] mag) {
         int size = magnitudes.length;
@@ -153,4 +177,6 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     private native void    nativeSetInterval(long nativeRef, double interval);
     private native int     nativeGetThreshold(long nativeRef);
     private native void    nativeSetThreshold(long nativeRef, int threshold);
+    private native boolean nativeGetPhasesEnabled(long nativeRef);
+    private native void    nativeSetPhasesEnabled(long nativeRef, boolean enabled);
 }
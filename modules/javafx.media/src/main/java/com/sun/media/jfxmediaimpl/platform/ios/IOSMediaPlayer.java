@@ -300,6 +300,7 @@ public final class IOSMediaPlayer extends NativeMediaPlayer {
         private int bandCount = 128;
         private double interval = 0.1;
         private int threshold = 60;
+        private boolean phasesEnabled = true;
         private float[] fakeData;
 
         public boolean getEnabled() {
@@ -335,6 +336,14 @@ public final class IOSMediaPlayer extends NativeMediaPlayer {
             this.threshold = threshold;
         }
 
+        public boolean getPhasesEnabled() {
+            return phasesEnabled;
+        }
+
+        public void setPhasesEnabled(boolean enabled) {
+            phasesEnabled = enabled;
+        }
+
         public float[] getMagnitudes(float[] mag) {
             int size = fakeData.length;
             if (mag == null || mag.length < size) {
@@ -36,6 +36,10 @@
 
 #include "gst/glib-compat-private.h"
 
+#if defined (GSTREAMER_LITE) && defined (__SSE2__)
+#include <emmintrin.h>
+#endif // GSTREAMER_LITE && __SSE2__
+
 GST_DEBUG_CATEGORY (equalizer_debug);
 #define GST_CAT_DEFAULT equalizer_debug
 
@@ -55,6 +59,7 @@ static void set_passthrough (GstIirEqualizer * equ);
 
 #ifdef GSTREAMER_LITE
 static void update_coefficients (GstIirEqualizer * equ);
+static void log_throughput (GstIirEqualizer * equ);
 #endif // GSTREAMER_LITE
 
 #define ALLOWED_CAPS \
@@ -147,6 +152,10 @@ struct _GstIirEqualizerBand
   /* second order iir filter */
   gdouble b1, b2;               /* IIR coefficients for outputs */
   gdouble a0, a1, a2;           /* IIR coefficients for inputs */
+
+#ifdef GSTREAMER_LITE
+  gboolean need_new_coefficients;
+#endif // GSTREAMER_LITE
 };
 
 struct _GstIirEqualizerBandClass
@@ -173,6 +182,9 @@ gst_iir_equalizer_band_set_property (GObject * object, guint prop_id,
       if (gain != band->gain) {
         BANDS_LOCK (equ);
         equ->need_new_coefficients = TRUE;
+#ifdef GSTREAMER_LITE
+        band->need_new_coefficients = TRUE;
+#endif // GSTREAMER_LITE
         band->gain = gain;
         set_passthrough (equ);
         BANDS_UNLOCK (equ);
@@ -188,6 +200,9 @@ gst_iir_equalizer_band_set_property (GObject * object, guint prop_id,
       if (freq != band->freq) {
         BANDS_LOCK (equ);
         equ->need_new_coefficients = TRUE;
+#ifdef GSTREAMER_LITE
+        band->need_new_coefficients = TRUE;
+#endif // GSTREAMER_LITE
         band->freq = freq;
         BANDS_UNLOCK (equ);
         GST_DEBUG_OBJECT (band, "changed freq = %lf ", band->freq);
@@ -202,6 +217,9 @@ gst_iir_equalizer_band_set_property (GObject * object, guint prop_id,
       if (width != band->width) {
         BANDS_LOCK (equ);
         equ->need_new_coefficients = TRUE;
+#ifdef GSTREAMER_LITE
+        band->need_new_coefficients = TRUE;
+#endif // GSTREAMER_LITE
         band->width = width;
         BANDS_UNLOCK (equ);
         GST_DEBUG_OBJECT (band, "changed width = %lf ", band->width);
@@ -216,6 +234,9 @@ gst_iir_equalizer_band_set_property (GObject * object, guint prop_id,
       if (type != band->type) {
         BANDS_LOCK (equ);
         equ->need_new_coefficients = TRUE;
+#ifdef GSTREAMER_LITE
+        band->need_new_coefficients = TRUE;
+#endif // GSTREAMER_LITE
         band->type = type;
         BANDS_UNLOCK (equ);
         GST_DEBUG_OBJECT (band, "changed type = %d ", band->type);
@@ -423,6 +444,11 @@ gst_iir_equalizer_finalize (GObject * object)
   }
   equ->freq_band_count = 0;
 
+#ifdef GSTREAMER_LITE
+  log_throughput (equ);
+  g_free (equ->coeffs);
+  g_free (equ->scratch);
+#endif // GSTREAMER_LITE
   g_free (equ->bands);
   g_free (equ->history);
 
@@ -632,19 +658,61 @@ static void
 update_coefficients (GstIirEqualizer * equ)
 {
   gint i, n = equ->freq_band_count;
+#ifdef GSTREAMER_LITE
+  gint rate = GST_AUDIO_FILTER_RATE (equ);
+  /* Only bands whose parameters changed need new coefficients, unless the
+   * band layout or the sample rate changed underneath all of them. */
+  gboolean all = (equ->coeffs_count != n || equ->coeffs_rate != rate);
+
+  if (equ->coeffs_count != n) {
+    equ->coeffs = g_renew (gdouble, equ->coeffs, 5 * MAX (n, 1));
+    equ->coeffs_count = n;
+  }
+  equ->coeffs_rate = rate;
+#endif // GSTREAMER_LITE
 
   for (i = 0; i < n; i++) {
+#ifdef GSTREAMER_LITE
+    GstIirEqualizerBand *band = equ->bands[i];
+    gdouble *c = equ->coeffs + 5 * i;
+
+    if (!all && !band->need_new_coefficients)
+      continue;
+    band->need_new_coefficients = FALSE;
+#endif // GSTREAMER_LITE
     if (equ->bands[i]->type == BAND_TYPE_PEAK)
       setup_peak_filter (equ, equ->bands[i]);
     else if (equ->bands[i]->type == BAND_TYPE_LOW_SHELF)
       setup_low_shelf_filter (equ, equ->bands[i]);
     else
       setup_high_shelf_filter (equ, equ->bands[i]);
+#ifdef GSTREAMER_LITE
+    c[0] = band->a0;
+    c[1] = band->a1;
+    c[2] = band->a2;
+    c[3] = band->b1;
+    c[4] = band->b2;
+#endif // GSTREAMER_LITE
   }
 
   equ->need_new_coefficients = FALSE;
 }
 
+#ifdef GSTREAMER_LITE
+static void
+log_throughput (GstIirEqualizer * equ)
+{
+  if (equ->stat_samples > 0 && equ->stat_time > 0) {
+    GST_INFO_OBJECT (equ, "%u bands: %" G_GUINT64_FORMAT " samples in %"
+        GST_TIME_FORMAT ", %.0f samples/s", equ->freq_band_count,
+        equ->stat_samples, GST_TIME_ARGS (equ->stat_time),
+        (gdouble) equ->stat_samples * GST_SECOND / equ->stat_time);
+  }
+  equ->stat_samples = 0;
+  equ->stat_time = 0;
+}
+#endif // GSTREAMER_LITE
+
 /* Must be called with transform lock! */
 static void
 alloc_history (GstIirEqualizer * equ, const GstAudioInfo * info)
@@ -673,6 +741,10 @@ gst_iir_equalizer_compute_frequencies (GstIirEqualizer * equ, guint new_count)
     return;
   }
 
+#ifdef GSTREAMER_LITE
+  log_throughput (equ);
+#endif // GSTREAMER_LITE
+
   old_count = equ->freq_band_count;
   equ->freq_band_count = new_count;
   GST_DEBUG ("bands %u -> %u", old_count, new_count);
@@ -723,6 +795,9 @@ gst_iir_equalizer_compute_frequencies (GstIirEqualizer * equ, guint new_count)
 
     equ->bands[i]->freq = freq0 + ((freq1 - freq0) / 2.0);
     equ->bands[i]->width = freq1 - freq0;
+#ifdef GSTREAMER_LITE
+    equ->bands[i]->need_new_coefficients = TRUE;
+#endif // GSTREAMER_LITE
     GST_DEBUG ("band[%2d] = '%lf'", i, equ->bands[i]->freq);
 
     g_object_notify (G_OBJECT (equ->bands[i]), "bandwidth");
@@ -845,10 +920,122 @@ guint size, guint channels)                                             \
   }                                                                     \
 }
 
+/* With GSTREAMER_LITE on SSE2 targets these are replaced by the block
+ * based functions below and only serve as the non-SSE2 fallback. */
 CREATE_OPTIMIZED_FUNCTIONS_INT (gint16, gfloat, -32768.0, 32767.0);
 CREATE_OPTIMIZED_FUNCTIONS (gfloat);
 CREATE_OPTIMIZED_FUNCTIONS (gdouble);
 
+#if defined (GSTREAMER_LITE) && defined (__SSE2__)
+/* Block based variant of the functions above. Samples are converted into
+ * an interleaved double scratch buffer with the channel count rounded up to
+ * an even number, then each band is run over the whole block for two
+ * channels at a time, so the coefficients and the filter state of a band
+ * stay in registers instead of being reloaded for every sample. Each band
+ * output is computed in double and rounded to the history type of the per
+ * sample functions (gfloat for gint16 and gfloat, gdouble for gdouble), so
+ * the output is the same as theirs. */
+
+#define EQ_BLOCK_FRAMES 256
+
+typedef struct {
+  gdouble x1[2], x2[2];     /* history of input values for a channel pair */
+  gdouble y1[2], y2[2];     /* history of output values for a channel pair */
+} SecondOrderHistorySSE2;
+
+static const guint history_size_sse2 = sizeof (SecondOrderHistorySSE2);
+
+#define ROUND_GFLOAT(v) _mm_cvtps_pd (_mm_cvtpd_ps (v))
+#define ROUND_GDOUBLE(v) (v)
+
+#define CREATE_SSE2_RUN_BANDS(HISTORY_TYPE,ROUND)                       \
+static void                                                             \
+gst_iir_equ_run_bands_sse2_ ## HISTORY_TYPE (GstIirEqualizer * equ,     \
+    gdouble * scratch, guint frames, guint pairs)                       \
+{                                                                       \
+  guint i, p, f, nf = MIN (equ->freq_band_count, equ->coeffs_count);    \
+  guint stride = 2 * pairs;                                             \
+  const gdouble *c = equ->coeffs;                                       \
+  SecondOrderHistorySSE2 *history = equ->history;                       \
+                                                                        \
+  for (f = 0; f < nf; f++, c += 5) {                                    \
+    const __m128d a0 = _mm_set1_pd (c[0]);                              \
+    const __m128d a1 = _mm_set1_pd (c[1]);                              \
+    const __m128d a2 = _mm_set1_pd (c[2]);                              \
+    const __m128d b1 = _mm_set1_pd (c[3]);                              \
+    const __m128d b2 = _mm_set1_pd (c[4]);                              \
+                                                                        \
+    for (p = 0; p < pairs; p++) {                                       \
+      SecondOrderHistorySSE2 *h = &history[p * nf + f];                 \
+      __m128d x1 = _mm_loadu_pd (h->x1);                                \
+      __m128d x2 = _mm_loadu_pd (h->x2);                                \
+      __m128d y1 = _mm_loadu_pd (h->y1);                                \
+      __m128d y2 = _mm_loadu_pd (h->y2);                                \
+      gdouble *d = scratch + 2 * p;                                     \
+                                                                        \
+      for (i = 0; i < frames; i++, d += stride) {                       \
+        __m128d in = _mm_loadu_pd (d);                                  \
+        __m128d out = ROUND (_mm_add_pd (_mm_add_pd (_mm_add_pd (       \
+                    _mm_add_pd (_mm_mul_pd (a0, in),                    \
+                        _mm_mul_pd (a1, x1)), _mm_mul_pd (a2, x2)),     \
+                _mm_mul_pd (b1, y1)), _mm_mul_pd (b2, y2)));            \
+        x2 = x1;                                                        \
+        x1 = in;                                                        \
+        y2 = y1;                                                        \
+        y1 = out;                                                       \
+        _mm_storeu_pd (d, out);                                         \
+      }                                                                 \
+                                                                        \
+      _mm_storeu_pd (h->x1, x1);                                        \
+      _mm_storeu_pd (h->x2, x2);                                        \
+      _mm_storeu_pd (h->y1, y1);                                        \
+      _mm_storeu_pd (h->y2, y2);                                        \
+    }                                                                   \
+  }                                                                     \
+}
+
+CREATE_SSE2_RUN_BANDS (gfloat, ROUND_GFLOAT);
+CREATE_SSE2_RUN_BANDS (gdouble, ROUND_GDOUBLE);
+
+#define CREATE_SSE2_FUNCTIONS(TYPE,HISTORY_TYPE,STORE)                  \
+static void                                                             \
+gst_iir_equ_process_sse2_ ## TYPE (GstIirEqualizer *equ, guint8 *data,  \
+guint size, guint channels)                                             \
+{                                                                       \
+  TYPE *samples = (TYPE *) data;                                        \
+  guint frames = size / channels / sizeof (TYPE);                       \
+  guint pairs = (channels + 1) / 2;                                     \
+  guint stride = 2 * pairs;                                             \
+  gdouble *scratch = equ->scratch;                                      \
+  guint i, c, n;                                                        \
+                                                                        \
+  while (frames > 0) {                                                  \
+    n = MIN (frames, EQ_BLOCK_FRAMES);                                  \
+    for (i = 0; i < n; i++) {                                           \
+      for (c = 0; c < channels; c++)                                    \
+        scratch[i * stride + c] = samples[i * channels + c];            \
+      for (; c < stride; c++)                                           \
+        scratch[i * stride + c] = 0.0;                                  \
+    }                                                                   \
+    gst_iir_equ_run_bands_sse2_ ## HISTORY_TYPE (equ, scratch, n, pairs); \
+    for (i = 0; i < n; i++) {                                           \
+      for (c = 0; c < channels; c++)                                    \
+        samples[i * channels + c] = STORE (scratch[i * stride + c]);    \
+    }                                                                   \
+    samples += n * channels;                                            \
+    frames -= n;                                                        \
+  }                                                                     \
+}
+
+#define STORE_GINT16(v) ((gint16) floor (CLAMP ((v), -32768.0, 32767.0)))
+#define STORE_GFLOAT(v) ((gfloat) (v))
+#define STORE_GDOUBLE(v) (v)
+
+CREATE_SSE2_FUNCTIONS (gint16, gfloat, STORE_GINT16);
+CREATE_SSE2_FUNCTIONS (gfloat, gfloat, STORE_GFLOAT);
+CREATE_SSE2_FUNCTIONS (gdouble, gdouble, STORE_GDOUBLE);
+#endif // GSTREAMER_LITE && __SSE2__
+
 static GstFlowReturn
 gst_iir_equalizer_transform_ip (GstBaseTransform * btrans, GstBuffer * buf)
 {
@@ -890,7 +1077,23 @@ gst_iir_equalizer_transform_ip (GstBaseTransform * btrans, GstBuffer * buf)
   BANDS_UNLOCK (equ);
 
   gst_buffer_map (buf, &map, GST_MAP_READWRITE);
+#ifdef GSTREAMER_LITE
+  if (G_UNLIKELY (gst_debug_category_get_threshold (equalizer_debug) >=
+          GST_LEVEL_INFO)) {
+    GstClockTime start = gst_util_get_timestamp ();
+
+    equ->process (equ, map.data, map.size, channels);
+
+    BANDS_LOCK (equ);
+    equ->stat_time += gst_util_get_timestamp () - start;
+    equ->stat_samples += map.size / GST_AUDIO_FILTER_BPS (filter);
+    BANDS_UNLOCK (equ);
+  } else {
+    equ->process (equ, map.data, map.size, channels);
+  }
+#else // GSTREAMER_LITE
   equ->process (equ, map.data, map.size, channels);
+#endif // GSTREAMER_LITE
   gst_buffer_unmap (buf, &map);
 
   return GST_FLOW_OK;
@@ -918,6 +1121,38 @@ gst_iir_equalizer_setup (GstAudioFilter * audio, const GstAudioInfo * info)
       return FALSE;
   }
 
+#if defined (GSTREAMER_LITE) && defined (__SSE2__)
+  /* Same formats, processed a block and two channels at a time */
+  switch (GST_AUDIO_INFO_FORMAT (info)) {
+    case GST_AUDIO_FORMAT_S16:
+      equ->process = gst_iir_equ_process_sse2_gint16;
+      break;
+    case GST_AUDIO_FORMAT_F32:
+      equ->process = gst_iir_equ_process_sse2_gfloat;
+      break;
+    default:
+      equ->process = gst_iir_equ_process_sse2_gdouble;
+      break;
+  }
+  /* One pair history per channel is more than needed, but keeps
+   * alloc_history () independent of the process function. */
+  equ->history_size = history_size_sse2;
+
+  if (equ->scratch_channels != GST_AUDIO_INFO_CHANNELS (info)) {
+    equ->scratch_channels = GST_AUDIO_INFO_CHANNELS (info);
+    g_free (equ->scratch);
+    equ->scratch = g_new (gdouble,
+        EQ_BLOCK_FRAMES * 2 * ((equ->scratch_channels + 1) / 2));
+  }
+#endif // GSTREAMER_LITE && __SSE2__
+
+#ifdef GSTREAMER_LITE
+  /* The coefficients depend on the rate, let the next buffer pick it up */
+  BANDS_LOCK (equ);
+  equ->need_new_coefficients = TRUE;
+  BANDS_UNLOCK (equ);
+#endif // GSTREAMER_LITE
+
   alloc_history (equ, info);
   return TRUE;
 }
@@ -68,6 +68,21 @@ struct _GstIirEqualizer
   gboolean need_new_coefficients;
 
   ProcessFunc process;
+
+#ifdef GSTREAMER_LITE
+  /* a0, a1, a2, b1, b2 for each band, packed for the processing loop */
+  gdouble *coeffs;
+  guint coeffs_count;
+  gint coeffs_rate;
+
+  /* interleaved working buffer for the block based process functions */
+  gdouble *scratch;
+  guint scratch_channels;
+
+  /* throughput statistics, only gathered when INFO logging is enabled */
+  guint64 stat_samples;
+  GstClockTime stat_time;
+#endif // GSTREAMER_LITE
 };
 
 struct _GstIirEqualizerClass
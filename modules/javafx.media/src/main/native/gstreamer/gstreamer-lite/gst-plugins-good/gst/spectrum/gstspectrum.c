@@ -59,8 +59,13 @@
 
 #include <string.h>
 #include <math.h>
+#include <float.h>
 #include "gstspectrum.h"
 
+#if defined (GSTREAMER_LITE) && defined (__SSE__)
+#include <xmmintrin.h>
+#endif // GSTREAMER_LITE && __SSE__
+
 GST_DEBUG_CATEGORY_STATIC (gst_spectrum_debug);
 #define GST_CAT_DEFAULT gst_spectrum_debug
 
@@ -251,6 +256,17 @@ gst_spectrum_alloc_channel_data (GstSpectrum * spectrum)
   GST_DEBUG_OBJECT (spectrum, "allocating data for %d channels",
       spectrum->num_channels);
 
+#ifdef GSTREAMER_LITE
+  /* The Hamming window only depends on nfft, so compute it once here instead
+   * of evaluating cos() for every sample of every FFT. Coefficients match
+   * gst_fft_f32_window (GST_FFT_WINDOW_HAMMING). */
+  spectrum->window = g_new (gfloat, nfft);
+  for (i = 0; i < (gint) nfft; i++)
+    spectrum->window[i] = (gfloat) (0.53836 - 0.46164 *
+        cos (2.0 * G_PI * i / nfft));
+  spectrum->power = g_new0 (gfloat, bands);
+#endif // GSTREAMER_LITE
+
   spectrum->channel_data = g_new (GstSpectrumChannel, spectrum->num_channels);
   for (i = 0; i < spectrum->num_channels; i++) {
     cd = &spectrum->channel_data[i];
@@ -285,6 +301,12 @@ gst_spectrum_free_channel_data (GstSpectrum * spectrum)
     }
     g_free (spectrum->channel_data);
     spectrum->channel_data = NULL;
+#ifdef GSTREAMER_LITE
+    g_free (spectrum->window);
+    spectrum->window = NULL;
+    g_free (spectrum->power);
+    spectrum->power = NULL;
+#endif // GSTREAMER_LITE
   }
 }
 
@@ -762,6 +784,39 @@ gst_spectrum_message_new (GstSpectrum * spectrum, GstClockTime timestamp,
   return gst_message_new_element (GST_OBJECT (spectrum), s);
 }
 
+#ifdef GSTREAMER_LITE
+/* Computes |X[k]|^2 / nfft^2 for every band, clamped from below to
+ * min_power so that the following log10 never sees zero. */
+static void
+gst_spectrum_power (const GstFFTF32Complex * freqdata, gfloat * power,
+    guint bands, gfloat scale, gfloat min_power)
+{
+  guint i = 0;
+
+#ifdef __SSE__
+  const __m128 vscale = _mm_set1_ps (scale);
+  const __m128 vmin_power = _mm_set1_ps (min_power);
+
+  for (; i + 4 <= bands; i += 4) {
+    /* freqdata is interleaved (r, i), deinterleave 4 bins at a time */
+    __m128 lo = _mm_loadu_ps ((const gfloat *) &freqdata[i]);
+    __m128 hi = _mm_loadu_ps ((const gfloat *) &freqdata[i + 2]);
+    __m128 re = _mm_shuffle_ps (lo, hi, _MM_SHUFFLE (2, 0, 2, 0));
+    __m128 im = _mm_shuffle_ps (lo, hi, _MM_SHUFFLE (3, 1, 3, 1));
+    __m128 p = _mm_add_ps (_mm_mul_ps (re, re), _mm_mul_ps (im, im));
+    _mm_storeu_ps (&power[i],
+        _mm_max_ps (_mm_mul_ps (p, vscale), vmin_power));
+  }
+#endif // __SSE__
+
+  for (; i < bands; i++) {
+    gfloat p = (freqdata[i].r * freqdata[i].r +
+        freqdata[i].i * freqdata[i].i) * scale;
+    power[i] = (p < min_power) ? min_power : p;
+  }
+}
+#endif // GSTREAMER_LITE
+
 static void
 gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
     guint input_pos)
@@ -777,14 +832,47 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
   GstFFTF32Complex *freqdata = cd->freqdata;
   GstFFTF32 *fft_ctx = cd->fft_ctx;
 
+#ifdef GSTREAMER_LITE
+  {
+    /* Unroll the ring buffer and apply the cached window in a single pass,
+     * both halves are plain loops the compiler can vectorize. */
+    const gfloat *window = spectrum->window;
+    guint head = nfft - input_pos;
+
+    for (i = 0; i < head; i++)
+      input_tmp[i] = input[input_pos + i] * window[i];
+    for (i = head; i < nfft; i++)
+      input_tmp[i] = input[i - head] * window[i];
+  }
+#else // GSTREAMER_LITE
   for (i = 0; i < nfft; i++)
     input_tmp[i] = input[(input_pos + i) % nfft];
 
   gst_fft_f32_window (fft_ctx, input_tmp, GST_FFT_WINDOW_HAMMING);
+#endif // GSTREAMER_LITE
 
   gst_fft_f32_fft (fft_ctx, input_tmp, freqdata);
 
   if (spectrum->message_magnitude) {
+#ifdef GSTREAMER_LITE
+    gfloat *power = spectrum->power;
+    gfloat min_power = (gfloat) pow (10.0, threshold / 10.0);
+    gfloat val;
+
+    /* Clamping in the power domain makes the threshold check branchless and
+     * keeps log10 away from zero; the dB clamp below only matters when
+     * min_power underflows for very low thresholds. */
+    if (min_power < FLT_MIN)
+      min_power = FLT_MIN;
+    gst_spectrum_power (freqdata, power, bands,
+        1.0f / ((gfloat) nfft * (gfloat) nfft), min_power);
+
+    /* Calculate magnitude in db */
+    for (i = 0; i < bands; i++) {
+      val = 10.0f * log10f (power[i]);
+      spect_magnitude[i] += (val < threshold) ? (gfloat) threshold : val;
+    }
+#else // GSTREAMER_LITE
     gdouble val;
     /* Calculate magnitude in db */
     for (i = 0; i < bands; i++) {
@@ -796,6 +884,7 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
         val = threshold;
       spect_magnitude[i] += val;
     }
+#endif // GSTREAMER_LITE
   }
 
   if (spectrum->message_phase) {
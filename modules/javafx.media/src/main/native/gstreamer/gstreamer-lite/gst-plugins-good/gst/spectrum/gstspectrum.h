@@ -91,6 +91,11 @@ struct _GstSpectrum
 
   GstSpectrumInputData input_data;
 
+#ifdef GSTREAMER_LITE
+  gfloat *window;               /* cached Hamming window, nfft entries */
+  gfloat *power;                /* per band power scratch, bands entries */
+#endif // GSTREAMER_LITE
+
 #if defined (GSTREAMER_LITE) && defined (OSX)
   guint bps_user; // User provided values to avoid more complex spectrum initialization
   guint bpf_user;
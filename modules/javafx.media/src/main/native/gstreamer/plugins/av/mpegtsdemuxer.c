@@ -81,6 +81,16 @@ struct _MpegTSDemuxer
     volatile gboolean is_closing;
     gboolean          update;
 
+    gboolean          is_chain_waiting; // protected by lock
+    gint64            read_wait_size;   // protected by lock, bytes reader waits for or 0
+
+    GstBufferList     *audio_list;      // audio buffers not pushed yet, owned by reader thread
+    GstFlowReturn     audio_list_result; // result of pushing audio_list from read callback, owned by reader thread
+
+    guint64           stat_packets;
+    guint64           stat_bytes;
+    gint64            stat_start_time;
+
     AVFormatContext   *context;
 
     GThread           *reader_thread;
@@ -118,6 +128,7 @@ struct _MpegTSDemuxerClass
 #define BUFFER_SIZE   4096             // Bytes. Better take it from JavaSource.
 #define ADAPTER_LIMIT 40 * BUFFER_SIZE // Initial adapter limit. It grows if unlimited by adding LIMIT_STEP
 #define LIMIT_STEP    10 * BUFFER_SIZE
+#define AUDIO_BATCH_SIZE 8             // Audio buffers pushed downstream with one gst_pad_push_list()
 
 /***********************************************************************************
  * Debug category and pad templates
@@ -248,6 +259,10 @@ static void mpegts_demuxer_init(MpegTSDemuxer *demuxer)
     demuxer->reader_thread = NULL;
     demuxer->numpads = 0;
     demuxer->base_pts = GST_CLOCK_TIME_NONE;
+    demuxer->is_chain_waiting = FALSE;
+    demuxer->read_wait_size = 0;
+    demuxer->audio_list = NULL;
+    demuxer->audio_list_result = GST_FLOW_OK;
 }
 
 static void mpegts_demuxer_finalize(GObject *object)
@@ -353,14 +368,19 @@ static GstFlowReturn mpegts_demuxer_chain(GstPad *pad, GstObject *parent, GstBuf
     while (((gint64)gst_adapter_available(demuxer->sink_adapter) + gst_buffer_get_size(buf)) >= demuxer->adapter_limit_size &&
            result == GST_FLOW_OK)
     {
+        demuxer->is_chain_waiting = TRUE;
         g_cond_wait(&demuxer->del_cond, &demuxer->lock);
+        demuxer->is_chain_waiting = FALSE;
         result = get_locked_result(demuxer);
     }
 
     if (result == GST_FLOW_OK)
     {
         gst_adapter_push(demuxer->sink_adapter, buf);
-        g_cond_signal(&demuxer->add_cond);
+        // Wake up reader only when it has enough data to continue
+        if (demuxer->read_wait_size > 0 &&
+            (gint64)gst_adapter_available(demuxer->sink_adapter) >= demuxer->read_wait_size)
+            g_cond_signal(&demuxer->add_cond);
     }
     else
     {
@@ -657,12 +677,56 @@ static void mpegts_demuxer_check_streams(MpegTSDemuxer *demuxer)
 /***********************************************************************************
  * Push functions
  ***********************************************************************************/
-static inline GstBuffer* packet_to_buffer(AVPacket *packet)
+#if PACKET_UNREF
+static void free_packet(gpointer data)
 {
-    GstBuffer* result = gst_buffer_new_allocate(NULL, packet->size, NULL);
-    if (result != NULL)
-        gst_buffer_fill(result, 0, packet->data, packet->size);
-    return result;
+    AVPacket *packet = (AVPacket*)data;
+    av_packet_free(&packet);
+}
+#endif
+
+// Reference counted packets are moved into the buffer, so data is not copied.
+// Packet is blank after this call, read timestamps before calling it.
+static GstBuffer* packet_to_buffer(AVPacket *packet)
+{
+#if PACKET_UNREF
+    if (packet->buf != NULL)
+    {
+        AVPacket *ref = av_packet_alloc();
+        if (ref != NULL)
+        {
+            av_packet_move_ref(ref, packet);
+            return gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, ref->data, ref->size,
+                                               0, ref->size, ref, free_packet);
+        }
+    }
+#endif
+
+    void *buffer_data = av_mallocz(packet->size);
+    if (buffer_data == NULL)
+        return NULL;
+
+    memcpy(buffer_data, packet->data, packet->size);
+    return gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
+}
+
+static GstFlowReturn push_audio_list(MpegTSDemuxer *demuxer)
+{
+    GstBufferList *list = demuxer->audio_list;
+    if (list == NULL)
+        return GST_FLOW_OK;
+
+    demuxer->audio_list = NULL;
+    return gst_pad_push_list(demuxer->audio.sourcepad, list);
+}
+
+static void drop_audio_list(MpegTSDemuxer *demuxer)
+{
+    if (demuxer->audio_list != NULL)
+    {
+        gst_buffer_list_unref(demuxer->audio_list);
+        demuxer->audio_list = NULL;
+    }
 }
 
 static inline gboolean same_stream(MpegTSDemuxer *demuxer, Stream *stream, AVPacket *packet)
@@ -682,23 +746,21 @@ static GstFlowReturn process_video_packet(MpegTSDemuxer *demuxer, AVPacket *pack
     if (!same_stream(demuxer, stream, packet))
         return result;
 
-    GstBuffer     *buffer = NULL;
+    GstEvent      *newsegment_event = NULL;
+    int64_t       pts = packet->pts;
+    int64_t       duration = packet->duration;
+    GstBuffer     *buffer = packet_to_buffer(packet);
 
-    GstEvent *newsegment_event = NULL;
-    void *buffer_data = av_mallocz(packet->size);
-    if (buffer_data != NULL)
+    if (buffer != NULL)
     {
-        memcpy(buffer_data, packet->data, packet->size);
-        buffer = gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
-
-        if (packet->pts != AV_NOPTS_VALUE)
+        if (pts != AV_NOPTS_VALUE)
         {
             if (demuxer->base_pts == GST_CLOCK_TIME_NONE)
             {
-                demuxer->base_pts = PTS_TO_GSTTIME(packet->pts) + stream->offset_time;
+                demuxer->base_pts = PTS_TO_GSTTIME(pts) + stream->offset_time;
             }
 
-            gint64 time = PTS_TO_GSTTIME(packet->pts) + stream->offset_time - demuxer->base_pts;
+            gint64 time = PTS_TO_GSTTIME(pts) + stream->offset_time - demuxer->base_pts;
             if (time < 0)
                 time = 0;
 
@@ -729,8 +791,8 @@ static GstFlowReturn process_video_packet(MpegTSDemuxer *demuxer, AVPacket *pack
             GST_BUFFER_TIMESTAMP(buffer) = time;
         }
 
-        if (packet->duration != 0)
-            GST_BUFFER_DURATION(buffer) = PTS_TO_GSTTIME(packet->duration);
+        if (duration != 0)
+            GST_BUFFER_DURATION(buffer) = PTS_TO_GSTTIME(duration);
 
         g_mutex_lock(&demuxer->lock);
         stream->segment.position = GST_BUFFER_TIMESTAMP(buffer);
@@ -758,12 +820,23 @@ static GstFlowReturn process_video_packet(MpegTSDemuxer *demuxer, AVPacket *pack
     } else
         result = GST_FLOW_ERROR;
 
+    // Audio held back in audio_list goes downstream before any video event
+    // or buffer. Once the video queue is full gst_pad_push() blocks until
+    // the sinks preroll, which never happens if audio is still waiting here.
+    if (result == GST_FLOW_OK)
+        result = push_audio_list(demuxer);
+
     if (newsegment_event)
-        result = gst_pad_push_event(stream->sourcepad, newsegment_event) ? GST_FLOW_OK : GST_FLOW_FLUSHING;
+    {
+        if (result == GST_FLOW_OK)
+            result = gst_pad_push_event(stream->sourcepad, newsegment_event) ? GST_FLOW_OK : GST_FLOW_FLUSHING;
+        else
+            gst_event_unref(newsegment_event);
+    }
 
     if (result == GST_FLOW_OK)
         result = gst_pad_push(stream->sourcepad, buffer);
-    else
+    else if (buffer != NULL)
         gst_buffer_unref(buffer);
 
     return result;
@@ -774,33 +847,35 @@ static GstFlowReturn process_audio_packet(MpegTSDemuxer *demuxer, AVPacket *pack
     GstFlowReturn result = GST_FLOW_OK;
     Stream *stream = &demuxer->audio;
 
+    // Report a failed push of held back audio from the read callback
+    if (demuxer->audio_list_result != GST_FLOW_OK)
+        return demuxer->audio_list_result;
+
     if (!same_stream(demuxer, stream, packet))
         return result;
 
-    GstBuffer *buffer = NULL;
     GstEvent *newsegment_event = NULL;
-    void *buffer_data = av_mallocz(packet->size);
+    int64_t  pts = packet->pts;
+    int64_t  duration = packet->duration;
+    GstBuffer *buffer = packet_to_buffer(packet);
 
-    if (buffer_data != NULL)
+    if (buffer != NULL)
     {
-        memcpy(buffer_data, packet->data, packet->size);
-        buffer = gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
-
-        if (packet->pts != AV_NOPTS_VALUE)
+        if (pts != AV_NOPTS_VALUE)
         {
             if (demuxer->base_pts == GST_CLOCK_TIME_NONE)
             {
-                demuxer->base_pts = PTS_TO_GSTTIME(packet->pts) + stream->offset_time;
+                demuxer->base_pts = PTS_TO_GSTTIME(pts) + stream->offset_time;
             }
 
-            gint64 time = PTS_TO_GSTTIME(packet->pts) + stream->offset_time - demuxer->base_pts;
+            gint64 time = PTS_TO_GSTTIME(pts) + stream->offset_time - demuxer->base_pts;
             if (time < 0)
                 time = 0;
 
             if (stream->last_time > 0 && time < (gint64) (stream->last_time - PTS_TO_GSTTIME(G_MAXUINT32)))
             {
                 stream->offset_time += PTS_TO_GSTTIME(MAX_PTS + 1); // Wraparound occured
-                time = PTS_TO_GSTTIME(packet->pts) + stream->offset_time;
+                time = PTS_TO_GSTTIME(pts) + stream->offset_time;
 #ifdef VERBOSE_DEBUG_AUDIO
                 g_print("[Audio wraparound] updating offset_time to %lld\n", stream->offset_time);
 #endif
@@ -808,7 +883,7 @@ static GstFlowReturn process_audio_packet(MpegTSDemuxer *demuxer, AVPacket *pack
 
 #ifdef VERBOSE_DEBUG_AUDIO
             g_print("[Audio]: pts=%lld(%.4f) time=%lld (%.4f) offset_time=%lld last_time=%lld\n",
-                    PTS_TO_GSTTIME(packet->pts), (double) PTS_TO_GSTTIME(packet->pts) / GST_SECOND,
+                    PTS_TO_GSTTIME(pts), (double) PTS_TO_GSTTIME(pts) / GST_SECOND,
                     time, (double) time / GST_SECOND, stream->offset_time, stream->last_time);
 #endif
 
@@ -816,8 +891,8 @@ static GstFlowReturn process_audio_packet(MpegTSDemuxer *demuxer, AVPacket *pack
             GST_BUFFER_TIMESTAMP(buffer) = time;
         }
 
-        if (packet->duration != 0)
-            GST_BUFFER_DURATION(buffer) = PTS_TO_GSTTIME(packet->duration);
+        if (duration != 0)
+            GST_BUFFER_DURATION(buffer) = PTS_TO_GSTTIME(duration);
 
         g_mutex_lock(&demuxer->lock);
         stream->segment.position = GST_BUFFER_TIMESTAMP(buffer);
@@ -846,11 +921,26 @@ static GstFlowReturn process_audio_packet(MpegTSDemuxer *demuxer, AVPacket *pack
         result = GST_FLOW_ERROR;
 
     if (newsegment_event)
-        result = gst_pad_push_event(stream->sourcepad, newsegment_event) ? GST_FLOW_OK : GST_FLOW_FLUSHING;
+    {
+        // Buffers queued before new segment belong to the old one
+        result = push_audio_list(demuxer);
+        if (result == GST_FLOW_OK)
+            result = gst_pad_push_event(stream->sourcepad, newsegment_event) ? GST_FLOW_OK : GST_FLOW_FLUSHING;
+        else
+            gst_event_unref(newsegment_event);
+    }
 
     if (result == GST_FLOW_OK)
-        result = gst_pad_push(stream->sourcepad, buffer);
-    else
+    {
+        // Audio packets are small and many, so push them in batches
+        if (demuxer->audio_list == NULL)
+            demuxer->audio_list = gst_buffer_list_new_sized(AUDIO_BATCH_SIZE);
+        gst_buffer_list_add(demuxer->audio_list, buffer);
+
+        if (gst_buffer_list_length(demuxer->audio_list) >= AUDIO_BATCH_SIZE)
+            result = push_audio_list(demuxer);
+    }
+    else if (buffer != NULL)
         gst_buffer_unref(buffer);
 
 #ifdef VERBOSE_DEBUG_AUDIO
@@ -881,6 +971,8 @@ static ParseAction mpegts_demuxer_read_frame(MpegTSDemuxer *demuxer)
     switch(ret)
     {
         case 0:
+            demuxer->stat_packets++;
+            demuxer->stat_bytes += packet.size;
 #ifdef ENABLE_VIDEO
             if (packet.stream_index == demuxer->video.stream_index) // Video
                 flow_result = process_video_packet(demuxer, &packet);
@@ -891,6 +983,9 @@ static ParseAction mpegts_demuxer_read_frame(MpegTSDemuxer *demuxer)
 
             if (flow_result != GST_FLOW_OK)
             {
+                // Do not leave decoded audio behind when stopping
+                push_audio_list(demuxer);
+
                 if (flow_result != GST_FLOW_FLUSHING)
                     post_message(demuxer, "Send packet failed", GST_MESSAGE_ERROR, GST_STREAM_ERROR, GST_STREAM_ERROR_DEMUX);
 
@@ -907,7 +1002,14 @@ static ParseAction mpegts_demuxer_read_frame(MpegTSDemuxer *demuxer)
 
         default:
             if (demuxer->is_eos && demuxer->is_last_buffer_send) // Send EOS
+            {
+                gint64 elapsed = g_get_monotonic_time() - demuxer->stat_start_time;
+                GST_INFO_OBJECT(demuxer, "demuxed %" G_GUINT64_FORMAT " packets, %" G_GUINT64_FORMAT
+                                " bytes in %" G_GINT64_FORMAT " us", demuxer->stat_packets, demuxer->stat_bytes, elapsed);
+
+                push_audio_list(demuxer);
                 mpegts_demuxer_push_to_sources(demuxer, gst_event_new_eos());
+            }
             else
                 post_error(demuxer, "LibAV stream parse error", ret, GST_STREAM_ERROR_DEMUX); // Send Error
             result = PA_STOP;
@@ -981,6 +1083,10 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
                 demuxer->adapter_limit_type = UNLIMITED;
                 demuxer->adapter_limit_size = ADAPTER_LIMIT;
 
+                demuxer->stat_packets = 0;
+                demuxer->stat_bytes = 0;
+                demuxer->stat_start_time = g_get_monotonic_time();
+
                 AVInputFormat* iformat = av_find_input_format("mpegts");
 
                 action = get_init_action(demuxer, avformat_open_input(&demuxer->context, "", iformat, NULL));
@@ -1014,6 +1120,9 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
 #endif
             demuxer->is_reading = FALSE;
 
+            drop_audio_list(demuxer);
+            demuxer->audio_list_result = GST_FLOW_OK;
+
             if (demuxer->context)
             {
                 av_free(demuxer->context->pb->buffer);
@@ -1051,8 +1160,22 @@ static int mpegts_demuxer_read_packet(void *opaque, uint8_t *buffer, int size)
             demuxer->adapter_limit_size += LIMIT_STEP;
             g_cond_signal(&demuxer->del_cond);
         }
+        else if (demuxer->audio_list != NULL)
+        {
+            // Push held back audio before blocking, so downstream does not
+            // run dry while we wait for more input.
+            g_mutex_unlock(&demuxer->lock);
+            GstFlowReturn audio_result = push_audio_list(demuxer);
+            g_mutex_lock(&demuxer->lock);
+            if (audio_result != GST_FLOW_OK)
+                demuxer->audio_list_result = audio_result;
+        }
         else
+        {
+            demuxer->read_wait_size = demuxer->offset + size;
             g_cond_wait(&demuxer->add_cond, &demuxer->lock);
+            demuxer->read_wait_size = 0;
+        }
 
         available = gst_adapter_available(demuxer->sink_adapter);
     }
@@ -1072,7 +1195,8 @@ static int mpegts_demuxer_read_packet(void *opaque, uint8_t *buffer, int size)
             else
                 demuxer->offset += size;
 
-            g_cond_signal(&demuxer->del_cond);
+            if (demuxer->is_chain_waiting)
+                g_cond_signal(&demuxer->del_cond);
             result = size;
 
 #ifdef FAKE_ERROR
@@ -33,6 +33,8 @@ GST_DEBUG_CATEGORY (java_source_debug);
 #define _BS(val) (val ? "TRUE" : "FALSE")
 #define BUFFER_SIZE 4096
 #define MAX_READ_SIZE 65536
+#define BLOCK_RING_SLOT_SIZE 65536
+#define BLOCK_RING_MAX_DEPTH 32
 
 /***********************************************************************************
 * HLS Properties and Values
@@ -53,6 +55,8 @@ enum
     SIGNAL_CLOSE_CONNECTION,
     SIGNAL_PROPERTY,
     SIGNAL_GET_STREAM_SIZE,
+    SIGNAL_REGISTER_BLOCK_RING,
+    SIGNAL_READ_NEXT_BLOCK_TO_SLOT,
     LAST_SIGNAL
 };
 
@@ -65,7 +69,8 @@ enum
     PROP_STOP_ON_PAUSE,
     PROP_LOCATION,
     PROP_MIMETYPE,
-    PROP_HLS_MODE
+    PROP_HLS_MODE,
+    PROP_BLOCK_RING_DEPTH
 };
 
 /***********************************************************************************
@@ -81,6 +86,12 @@ enum
 /***********************************************************************************
 * Element structures are hidden from outside
 ***********************************************************************************/
+typedef struct _JavaSourceSlot
+{
+    JavaSource *element;
+    guint       index;
+} JavaSourceSlot;
+
 struct _JavaSource
 {
     GstElement    parent;
@@ -105,6 +116,14 @@ struct _JavaSource
     gchar*        location; // property controlled
     gchar*        mimetype; // property controlled
     gdouble       rate;
+
+    // Block ring. Java reads directly into these slots and we push them downstream
+    // wrapped into GstBuffers, so the data is never copied on our side.
+    guint          ring_depth; // property controlled, 0 disables the ring
+    guint8         *ring_data;
+    JavaSourceSlot ring_slots[BLOCK_RING_MAX_DEPTH];
+    guint32        ring_busy; // protected by lock, bit per slot owned by downstream
+    gboolean       ring_registered;
 };
 
 struct _JavaSourceClass
@@ -220,6 +239,12 @@ static void java_source_class_init (JavaSourceClass *klass)
         g_param_spec_string ("mimetype", "Source Mimetype", "Mimetype of the source", NULL,
         G_PARAM_WRITABLE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY));
 
+    g_object_class_install_property (gobject_klass, PROP_BLOCK_RING_DEPTH,
+        g_param_spec_uint ("block-ring-depth", "Block ring depth",
+        "Number of blocks Java may read ahead directly into GStreamer owned memory (0 - disabled)",
+        0, BLOCK_RING_MAX_DEPTH, 0,
+        G_PARAM_WRITABLE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY));
+
     klass->signals[SIGNAL_SEEK_DATA] = g_signal_new ("seek-data",
         G_TYPE_FROM_CLASS (klass),
         G_SIGNAL_RUN_LAST | G_SIGNAL_NO_RECURSE | G_SIGNAL_NO_HOOKS,
@@ -293,6 +318,28 @@ static void java_source_class_init (JavaSourceClass *klass)
         source_marshal_INT__VOID,
         G_TYPE_INT, /* return_type */
         0    /* n_params */ );
+
+    klass->signals[SIGNAL_REGISTER_BLOCK_RING] = g_signal_new ("register-block-ring",
+        G_TYPE_FROM_CLASS (klass),
+        G_SIGNAL_RUN_LAST | G_SIGNAL_NO_RECURSE | G_SIGNAL_NO_HOOKS,
+        0,
+        NULL, /* accumulator */
+        NULL, /* accu_data */
+        source_marshal_INT__POINTER_INT_INT,
+        G_TYPE_INT, /* return_type */
+        3,     /* n_params */
+        G_TYPE_POINTER, G_TYPE_INT, G_TYPE_INT);
+
+    klass->signals[SIGNAL_READ_NEXT_BLOCK_TO_SLOT] = g_signal_new ("read-next-block-to-slot",
+        G_TYPE_FROM_CLASS (klass),
+        G_SIGNAL_RUN_LAST | G_SIGNAL_NO_RECURSE | G_SIGNAL_NO_HOOKS,
+        0,
+        NULL, /* accumulator */
+        NULL, /* accu_data */
+        source_marshal_INT__INT,
+        G_TYPE_INT, /* return_type */
+        1,     /* n_params */
+        G_TYPE_INT);
 }
 
 static void java_source_init(JavaSource *element)
@@ -315,6 +362,11 @@ static void java_source_init(JavaSource *element)
     element->rate = 1.0; // Default to 1.0
 
     element->mimetype = NULL;
+
+    element->ring_depth = 0;
+    element->ring_data = NULL;
+    element->ring_busy = 0;
+    element->ring_registered = FALSE;
 }
 
 /***********************************************************************************
@@ -350,6 +402,9 @@ static void java_source_set_property (GObject *object, guint prop_id,
     case PROP_MIMETYPE:
         element->mimetype = g_strdup(g_value_get_string (value));
         break;
+    case PROP_BLOCK_RING_DEPTH:
+        element->ring_depth = g_value_get_uint (value);
+        break;
     default:
         break;
     }
@@ -375,6 +430,8 @@ static void java_source_finalize (GObject *object)
     g_free(element->location);
     if (element->mimetype)
         g_free(element->mimetype);
+    // Every wrapped slot holds a reference to the element, so nobody uses the ring here.
+    g_free(element->ring_data);
     G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -535,6 +592,130 @@ static gboolean java_source_event(GstPad *pad, GstObject *parent, GstEvent *even
     return gst_pad_event_default(pad, parent, event);
 }
 
+/***********************************************************************************
+* Block ring
+***********************************************************************************/
+static void java_source_release_slot(gpointer data)
+{
+    JavaSourceSlot *slot = (JavaSourceSlot*)data;
+    JavaSource     *element = slot->element;
+
+    g_mutex_lock(&element->lock);
+    element->ring_busy &= ~(1U << slot->index);
+    g_mutex_unlock(&element->lock);
+
+    gst_object_unref(element);
+}
+
+// Allocates the ring on first use and registers it with Java.
+// Returns FALSE if the ring is disabled or Java refused it.
+static gboolean java_source_register_ring(JavaSource *element)
+{
+    gint  accepted = 0;
+    guint i;
+
+    if (element->ring_registered)
+        return (element->ring_data != NULL);
+
+    element->ring_registered = TRUE;
+    if (element->ring_depth == 0)
+        return FALSE;
+
+    element->ring_data = (guint8*)g_try_malloc(element->ring_depth * BLOCK_RING_SLOT_SIZE);
+    if (element->ring_data == NULL)
+        return FALSE;
+
+    for (i = 0; i < element->ring_depth; i++)
+    {
+        element->ring_slots[i].element = element;
+        element->ring_slots[i].index = i;
+    }
+
+    g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_REGISTER_BLOCK_RING], 0,
+                  element->ring_data, (gint)element->ring_depth, BLOCK_RING_SLOT_SIZE, &accepted);
+    if (!accepted)
+    {
+        g_free(element->ring_data);
+        element->ring_data = NULL;
+    }
+
+    GST_DEBUG_OBJECT(element, "block ring depth %u, registered %s", element->ring_depth, _BS(accepted));
+
+    return (element->ring_data != NULL);
+}
+
+// Reads next block from Java. Returns number of bytes read or EOS_CODE/OTHER_ERROR_CODE.
+// If data was read *buffer is set to a new buffer, which is either a wrapped ring slot
+// or, when the ring is disabled or all slots are still owned by downstream, a copy.
+static gint java_source_read_next_block(JavaSource *element, GstBuffer **buffer)
+{
+    JavaSourceClass *klass = JAVA_SOURCE_GET_CLASS(element);
+    GstBuffer *buf = NULL;
+    GstMapInfo info;
+    gint       size = 0;
+    gint       slot = -1;
+    guint      i;
+
+    *buffer = NULL;
+
+    if (java_source_register_ring(element))
+    {
+        g_mutex_lock(&element->lock);
+        for (i = 0; i < element->ring_depth; i++)
+        {
+            if ((element->ring_busy & (1U << i)) == 0)
+            {
+                element->ring_busy |= (1U << i);
+                slot = (gint)i;
+                break;
+            }
+        }
+        g_mutex_unlock(&element->lock);
+    }
+
+    if (slot >= 0)
+    {
+        g_signal_emit(element, klass->signals[SIGNAL_READ_NEXT_BLOCK_TO_SLOT], 0, slot, &size);
+        if (size > 0 && size <= BLOCK_RING_SLOT_SIZE)
+        {
+            gst_object_ref(element); // released with the slot
+            *buffer = gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY,
+                element->ring_data + slot * BLOCK_RING_SLOT_SIZE, BLOCK_RING_SLOT_SIZE,
+                0, size, &element->ring_slots[slot], java_source_release_slot);
+        }
+        else
+        {
+            // Nothing went downstream, slot can be reused right away
+            g_mutex_lock(&element->lock);
+            element->ring_busy &= ~(1U << slot);
+            g_mutex_unlock(&element->lock);
+        }
+
+        return size;
+    }
+
+    g_signal_emit(element, klass->signals[SIGNAL_READ_NEXT_BLOCK], 0, &size);
+    if (size > 0)
+    {
+        buf = gst_buffer_new_allocate(NULL, size, NULL);
+        if (buf == NULL)
+            return size;
+
+        if (!gst_buffer_map(buf, &info, GST_MAP_WRITE))
+        {
+            gst_buffer_unref(buf);
+            return size;
+        }
+
+        g_signal_emit(element, klass->signals[SIGNAL_COPY_BLOCK], 0, info.data, size);
+
+        gst_buffer_unmap(buf, &info);
+        *buffer = buf;
+    }
+
+    return size;
+}
+
 /***********************************************************************************
 * source pad loop
 ***********************************************************************************/
@@ -629,25 +810,19 @@ next_event:
         case GST_EVENT_UNKNOWN: // Pushing buffers
             {
                 gint     size;
-                GstMapInfo info;
-                g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK], 0, &size);
+                GstBuffer *buffer = NULL;
+                size = java_source_read_next_block(element, &buffer);
                 if (size > 0)
                 {
-                    GstBuffer *buffer = gst_buffer_new_allocate(NULL, size, NULL);
-                    if (buffer)
+                    if (buffer == NULL)
+                    {
+                        result = GST_FLOW_ERROR;
+                        break;
+                    }
+                    else
                     {
                         GST_BUFFER_OFFSET(buffer) = element->position;
 
-                        if (!gst_buffer_map(buffer, &info, GST_MAP_WRITE))
-                        {
-                            result = GST_FLOW_ERROR;
-                            break;
-                        }
-
-                        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data, size);
-
-                        gst_buffer_unmap(buffer, &info);
-
                         if (element->discont)
                         {
                             buffer = gst_buffer_make_writable (buffer);
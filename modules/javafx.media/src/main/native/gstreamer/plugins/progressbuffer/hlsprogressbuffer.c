@@ -65,6 +65,9 @@ struct _HLSProgressBuffer
     GstFlowReturn srcresult;
 
     GstClockTime buffer_pts;
+
+    gint64       start_time; // monotonic time when we started waiting for the first buffer
+    gboolean     first_buffer_sent;
 };
 
 struct _HLSProgressBufferClass
@@ -195,6 +198,9 @@ static void hls_progress_buffer_init(HLSProgressBuffer *element)
     element->srcresult = GST_FLOW_OK;
 
     element->buffer_pts = GST_CLOCK_TIME_NONE;
+
+    element->start_time = g_get_monotonic_time();
+    element->first_buffer_sent = FALSE;
 }
 
 /**
@@ -381,6 +387,21 @@ static void send_hls_not_full_message(HLSProgressBuffer* element)
     gst_element_post_message(GST_ELEMENT(element), msg);
 }
 
+/**
+ * send_hls_first_buffer_message
+ *
+ * Sends HLS FIRST BUFFER message to the bus with time it took to get first data
+ * to demuxer since start or last flush.
+ */
+static void send_hls_first_buffer_message(HLSProgressBuffer* element, gint64 latency)
+{
+    GstStructure *s = gst_structure_new(HLS_PB_MESSAGE_FIRST_BUFFER,
+        "latency", G_TYPE_INT64, latency,
+        NULL);
+    GstMessage *msg = gst_message_new_application(GST_OBJECT(element), s);
+    gst_element_post_message(GST_ELEMENT(element), msg);
+}
+
 /**
  * hls_progress_buffer_loop()
  *
@@ -413,6 +434,7 @@ static void hls_progress_buffer_loop(void *data)
     if (result == GST_FLOW_OK)
     {
         GstBuffer *buffer = NULL;
+        gint64 first_buffer_latency = -1;
         guint64 read_position = cache_read_buffer(element->cache[element->cache_read_index], &buffer);
 
         if (read_position == element->cache_size[element->cache_read_index])
@@ -430,8 +452,20 @@ static void hls_progress_buffer_loop(void *data)
             element->buffer_pts = GST_CLOCK_TIME_NONE;
         }
 
+        if (!element->first_buffer_sent)
+        {
+            element->first_buffer_sent = TRUE;
+            first_buffer_latency = g_get_monotonic_time() - element->start_time;
+        }
+
         g_mutex_unlock(&element->lock);
 
+        if (first_buffer_latency >= 0)
+        {
+            GST_INFO_OBJECT(element, "first buffer after %" G_GINT64_FORMAT " us", first_buffer_latency);
+            send_hls_first_buffer_message(element, first_buffer_latency);
+        }
+
         // Send the data to the hls progressbuffer source pad
         result = gst_pad_push(element->srcpad, buffer);
 
@@ -564,6 +598,9 @@ static gboolean hls_progress_buffer_sink_event(GstPad *pad, GstObject *parent, G
         element->is_flushing = FALSE;
         element->srcresult = GST_FLOW_OK;
 
+        element->start_time = g_get_monotonic_time();
+        element->first_buffer_sent = FALSE;
+
         if (!element->is_eos && gst_pad_is_linked(element->srcpad))
             gst_pad_start_task(element->srcpad, hls_progress_buffer_loop, element, NULL);
 
@@ -600,6 +637,13 @@ static GstStateChangeReturn hls_progress_buffer_change_state (GstElement *e, Gst
 
     switch (transition)
     {
+    case GST_STATE_CHANGE_READY_TO_PAUSED:
+        g_mutex_lock(&element->lock);
+        element->start_time = g_get_monotonic_time();
+        element->first_buffer_sent = FALSE;
+        g_mutex_unlock(&element->lock);
+        break;
+
     case GST_STATE_CHANGE_PAUSED_TO_READY:
         hls_progress_buffer_flush_data(element);
         break;
@@ -35,6 +35,7 @@ G_BEGIN_DECLS
 #define HLS_PB_MESSAGE_RESUME           "hls_pb_resume"
 #define HLS_PB_MESSAGE_FULL             "hls_pb_full"
 #define HLS_PB_MESSAGE_NOT_FULL         "hls_pb_not_full"
+#define HLS_PB_MESSAGE_FIRST_BUFFER     "hls_pb_first_buffer"
 
 #define HLS_PROGRESS_BUFFER_TYPE            (hls_progress_buffer_get_type())
 #define HLS_PROGRESS_BUFFER(obj)            (G_TYPE_CHECK_INSTANCE_CAST((obj), HLS_PROGRESS_BUFFER_TYPE, HLSProgressBuffer))
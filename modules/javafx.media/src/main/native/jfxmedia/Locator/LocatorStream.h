@@ -75,6 +75,22 @@ public:
     /* Get stream size. */
     virtual int GetStreamSize() = 0;
 
+    /* GetBlockRingDepth returns the number of blocks the source wants to read ahead
+     * directly into pipeline owned memory, 0 if blocks should be copied by CopyBlock.
+     */
+    virtual int  GetBlockRingDepth() = 0;
+
+    /* RegisterBlockRing hands over depth slots of slotSize bytes each, starting at data.
+     * The memory stays valid until CloseConnection is called.
+     * Returns true if the source is going to use the ring.
+     */
+    virtual bool RegisterBlockRing(void* data, int depth, int slotSize) = 0;
+
+    /* ReadNextBlockToSlot reads next available block of data into the given ring slot.
+     * Return values are the same as for ReadNextBlock.
+     */
+    virtual int  ReadNextBlockToSlot(int slot) = 0;
+
     /* Virtual destructor */
     virtual ~CStreamCallbacks() {}
 };
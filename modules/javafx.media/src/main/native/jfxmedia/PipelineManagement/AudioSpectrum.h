@@ -65,6 +65,9 @@ public:
 
     virtual int        GetThreshold() = 0;
     virtual void       SetThreshold(int threshold) = 0;
+
+    virtual bool       IsPhasesEnabled() = 0;
+    virtual void       SetPhasesEnabled(bool isEnabled) = 0;
 };
 
 #endif // _AUDIO_SPECTRUM_H_
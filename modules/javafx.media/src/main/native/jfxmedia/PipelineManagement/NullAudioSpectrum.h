@@ -34,7 +34,7 @@
 
 class CNullAudioSpectrum : public CAudioSpectrum {
 public:
-    CNullAudioSpectrum() : CAudioSpectrum(), mEnabled(false) {}
+    CNullAudioSpectrum() : CAudioSpectrum(), mEnabled(false), mPhasesEnabled(true) {}
     virtual ~CNullAudioSpectrum() {}
 
     virtual bool IsEnabled() {
@@ -70,12 +70,21 @@ public:
         mThreshold = threshold;
     }
 
+    virtual bool IsPhasesEnabled() {
+        return mPhasesEnabled;
+    }
+
+    virtual void SetPhasesEnabled(bool isEnabled) {
+        mPhasesEnabled = isEnabled;
+    }
+
     virtual void UpdateBands(int size, const float* magnitudes, const float* phases) {
         // Do nothing...
     }
 
 private:
     bool mEnabled;
+    bool mPhasesEnabled;
     CBandsHolder *mBandsHolder;
     int mBandCount;
     double mInterval;
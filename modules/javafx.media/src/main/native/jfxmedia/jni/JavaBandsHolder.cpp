@@ -82,7 +82,9 @@ void CJavaBandsHolder::UpdateBands(int size, const float* magnitudes, const floa
 
         if (localMagnitudes && localPhases) {
             pEnv->SetFloatArrayRegion(localMagnitudes, 0, size, magnitudes);
-            pEnv->SetFloatArrayRegion(localPhases, 0, size, phases);
+            // phases are NULL when only magnitudes are computed
+            if (phases != NULL)
+                pEnv->SetFloatArrayRegion(localPhases, 0, size, phases);
         }
 
         pEnv->DeleteLocalRef(localMagnitudes);
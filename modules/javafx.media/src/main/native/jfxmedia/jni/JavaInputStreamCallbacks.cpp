@@ -41,6 +41,9 @@ jmethodID CJavaInputStreamCallbacks::m_SeekMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_CloseConnectionMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_PropertyMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_GetStreamSizeMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_GetBlockRingDepthMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_RegisterBlockRingMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_ReadNextBlockToSlotMID = 0;
 
 CJavaInputStreamCallbacks::CJavaInputStreamCallbacks()
     : m_ConnectionHolder(0)
@@ -148,6 +151,24 @@ bool CJavaInputStreamCallbacks::Init(JNIEnv *env, jobject jLocator)
             hasException = javaEnv.reportException();
         }
 
+        if (!hasException)
+        {
+            m_GetBlockRingDepthMID = env->GetMethodID(klass, "getBlockRingDepth", "()I");
+            hasException = javaEnv.reportException();
+        }
+
+        if (!hasException)
+        {
+            m_RegisterBlockRingMID = env->GetMethodID(klass, "registerBlockRing", "(Ljava/nio/ByteBuffer;I)Z");
+            hasException = javaEnv.reportException();
+        }
+
+        if (!hasException)
+        {
+            m_ReadNextBlockToSlotMID = env->GetMethodID(klass, "readNextBlock", "(I)I");
+            hasException = javaEnv.reportException();
+        }
+
         if (NULL != klass)
             env->DeleteLocalRef(klass);
 
@@ -348,3 +369,71 @@ int CJavaInputStreamCallbacks::GetStreamSize()
 
     return result;
 }
+
+int CJavaInputStreamCallbacks::GetBlockRingDepth()
+{
+    CJavaEnvironment javaEnv(m_jvm);
+    JNIEnv *pEnv = javaEnv.getEnvironment();
+    int result = 0;
+
+    if (pEnv) {
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (connection) {
+            result = pEnv->CallIntMethod(connection, m_GetBlockRingDepthMID);
+            pEnv->DeleteLocalRef(connection);
+        }
+
+        if (javaEnv.reportException()) {
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+bool CJavaInputStreamCallbacks::RegisterBlockRing(void* data, int depth, int slotSize)
+{
+    CJavaEnvironment javaEnv(m_jvm);
+    JNIEnv *pEnv = javaEnv.getEnvironment();
+    bool result = false;
+
+    if (pEnv) {
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (connection) {
+            // Java slices this buffer into slots, so the only crossing per block is readNextBlock(slot)
+            jobject ring = pEnv->NewDirectByteBuffer(data, (jlong)depth * slotSize);
+            if (ring) {
+                result = (pEnv->CallBooleanMethod(connection, m_RegisterBlockRingMID, ring, (jint)slotSize) == JNI_TRUE);
+                pEnv->DeleteLocalRef(ring);
+            }
+            pEnv->DeleteLocalRef(connection);
+        }
+
+        if (javaEnv.reportException()) {
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+int CJavaInputStreamCallbacks::ReadNextBlockToSlot(int slot)
+{
+    int result = -1;
+    CJavaEnvironment javaEnv(m_jvm);
+    JNIEnv *pEnv = javaEnv.getEnvironment();
+
+    if (pEnv) {
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (connection) {
+            result = pEnv->CallIntMethod(connection, m_ReadNextBlockToSlotMID, (jint)slot);
+            pEnv->DeleteLocalRef(connection);
+        }
+
+        if (javaEnv.clearException()) {
+            result = -2;
+        }
+    }
+
+    return result;
+}
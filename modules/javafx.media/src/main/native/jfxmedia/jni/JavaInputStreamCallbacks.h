@@ -47,6 +47,9 @@ virtual ~CJavaInputStreamCallbacks();
     void CloseConnection();
     int  Property(int prop, int value);
     int  GetStreamSize();
+    int  GetBlockRingDepth();
+    bool RegisterBlockRing(void* data, int depth, int slotSize);
+    int  ReadNextBlockToSlot(int slot);
 
 private:
     jobject          m_ConnectionHolder;
@@ -62,6 +65,9 @@ private:
     static jmethodID m_CloseConnectionMID;
     static jmethodID m_PropertyMID;
     static jmethodID m_GetStreamSizeMID;
+    static jmethodID m_GetBlockRingDepthMID;
+    static jmethodID m_RegisterBlockRingMID;
+    static jmethodID m_ReadNextBlockToSlotMID;
 };
 
 #endif // _JAVA_INPUT_STREAM_CALLBACKS_H_
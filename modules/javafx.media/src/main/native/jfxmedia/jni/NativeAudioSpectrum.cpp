@@ -96,6 +96,22 @@ Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeSetThreshold(JNIEnv *e
         pSpectrum->SetThreshold(threshold);
 }
 
+JNIEXPORT jboolean JNICALL
+Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeGetPhasesEnabled(JNIEnv *env, jobject obj, jlong nativeRef)
+{
+    CAudioSpectrum *pSpectrum = (CAudioSpectrum*)jlong_to_ptr(nativeRef);
+    return (NULL != pSpectrum) ? pSpectrum->IsPhasesEnabled() : JNI_FALSE;
+}
+
+JNIEXPORT void JNICALL
+Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeSetPhasesEnabled(JNIEnv *env, jobject obj, jlong nativeRef,
+                                                                                    jboolean enabled)
+{
+    CAudioSpectrum *pSpectrum = (CAudioSpectrum*)jlong_to_ptr(nativeRef);
+    if (pSpectrum != NULL)
+        pSpectrum->SetPhasesEnabled(enabled == JNI_TRUE);
+}
+
 #ifdef __cplusplus
 }
 #endif
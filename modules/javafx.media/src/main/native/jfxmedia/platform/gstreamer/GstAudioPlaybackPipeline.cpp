@@ -1413,6 +1413,18 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
             }
             else if (gst_structure_has_name(pStr, HLS_PB_MESSAGE_NOT_FULL))
                 pPipeline->m_bHLSPBFull = false;
+            else if (gst_structure_has_name(pStr, HLS_PB_MESSAGE_FIRST_BUFFER))
+            {
+#if ENABLE_LOGGING
+                gint64 latency = 0;
+                if (gst_structure_get_int64(pStr, "latency", &latency))
+                {
+                    char message[64];
+                    g_snprintf(message, sizeof(message), "HLS first buffer after %" G_GINT64_FORMAT " ms\n", latency / 1000);
+                    LOGGER_LOGMSG(LOGGER_DEBUG, message);
+                }
+#endif
+            }
         }
             break;
 #endif  //ENABLE_PROGRESS_BUFFER
@@ -1434,15 +1446,18 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
 
                 if (bandsNum > 0)
                 {
-                    float *magnitudes = new float[bandsNum];
-                    float *phases = new float[bandsNum];
-
                     const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
                     const GValue *phases_value = gst_structure_get_value(pStr, "phase");
+
+                    // "phase" is missing when phases are disabled
+                    float *magnitudes = new float[bandsNum];
+                    float *phases = (phases_value != NULL) ? new float[bandsNum] : NULL;
+
                     for (int i=0; i < bandsNum; i++)
                     {
                         magnitudes[i] = g_value_get_float( gst_value_list_get_value (magnitudes_value, i));
-                        phases[i] = g_value_get_float( gst_value_list_get_value (phases_value, i));
+                        if (phases != NULL)
+                            phases[i] = g_value_get_float( gst_value_list_get_value (phases_value, i));
                     }
                     pPipeline->GetAudioSpectrum()->UpdateBands((int)bandsNum, magnitudes, phases);
 
@@ -66,6 +66,7 @@ enum CODEC_ID
 #define HLS_PB_MESSAGE_HLS_EOS      "hls_pb_eos"
 #define HLS_PB_MESSAGE_FULL         "hls_pb_full"
 #define HLS_PB_MESSAGE_NOT_FULL     "hls_pb_not_full"
+#define HLS_PB_MESSAGE_FIRST_BUFFER "hls_pb_first_buffer"
 
 class CGstAudioPlaybackPipeline;
 struct sBusCallbackContent
@@ -130,3 +130,15 @@ void CGstAudioSpectrum::SetThreshold(int threshold)
 {
     g_object_set(m_pSpectrum, "threshold", threshold, NULL);
 }
+
+bool CGstAudioSpectrum::IsPhasesEnabled()
+{
+    gboolean message_phase;
+    g_object_get(m_pSpectrum, "message-phase", &message_phase, NULL);
+    return message_phase;
+}
+
+void CGstAudioSpectrum::SetPhasesEnabled(bool enabled)
+{
+    g_object_set(m_pSpectrum, "message-phase", enabled, NULL);
+}
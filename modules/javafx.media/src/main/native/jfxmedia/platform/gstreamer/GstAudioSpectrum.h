@@ -48,6 +48,9 @@ public:
     virtual int       GetThreshold();
     virtual void      SetThreshold(int threshold);
 
+    virtual bool      IsPhasesEnabled();
+    virtual void      SetPhasesEnabled(bool isEnabled);
+
 private:
     GstElement*            m_pSpectrum;
     volatile CBandsHolder* m_pHolder;
@@ -210,6 +210,14 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator* locator, GstElement*
             g_signal_connect (javaSource, "property", G_CALLBACK (SourceProperty), callbacks);
             g_signal_connect (javaSource, "get-stream-size", G_CALLBACK (SourceGetStreamSize), callbacks);
 
+            int blockRingDepth = callbacks->GetBlockRingDepth();
+            if (blockRingDepth > 0)
+            {
+                g_signal_connect (javaSource, "register-block-ring", G_CALLBACK (SourceRegisterBlockRing), callbacks);
+                g_signal_connect (javaSource, "read-next-block-to-slot", G_CALLBACK (SourceReadNextBlockToSlot), callbacks);
+                g_object_set (javaSource, "block-ring-depth", (guint)blockRingDepth, NULL);
+            }
+
             if (isRandomAccess)
                 g_signal_connect (javaSource, "read-block", G_CALLBACK (SourceReadBlock), callbacks);
 
@@ -312,6 +320,16 @@ int CGstPipelineFactory::SourceGetStreamSize(GstElement *src, gpointer data)
     return ((CStreamCallbacks*)data)->GetStreamSize();
 }
 
+gint CGstPipelineFactory::SourceRegisterBlockRing(GstElement *src, gpointer ring, int depth, int slotSize, gpointer data)
+{
+    return ((CStreamCallbacks*)data)->RegisterBlockRing(ring, depth, slotSize) ? 1 : 0;
+}
+
+gint CGstPipelineFactory::SourceReadNextBlockToSlot(GstElement *src, int slot, gpointer data)
+{
+    return ((CStreamCallbacks*)data)->ReadNextBlockToSlot(slot);
+}
+
 void CGstPipelineFactory::SourceCloseConnection(GstElement *src, gpointer data)
 {
     CStreamCallbacks* callbacks = (CStreamCallbacks*)data;
@@ -323,6 +341,8 @@ void CGstPipelineFactory::SourceCloseConnection(GstElement *src, gpointer data)
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceCloseConnection), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceProperty), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceGetStreamSize), callbacks);
+    g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceRegisterBlockRing), callbacks);
+    g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceReadNextBlockToSlot), callbacks);
     delete callbacks;
 }
 
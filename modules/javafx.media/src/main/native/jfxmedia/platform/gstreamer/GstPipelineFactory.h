@@ -92,6 +92,8 @@ private:
     static void     SourceCloseConnection(GstElement *src, gpointer data);
     static int      SourceProperty(GstElement *src, int prop, int value, gpointer data);
     static int      SourceGetStreamSize(GstElement *src, gpointer data);
+    static gint     SourceRegisterBlockRing(GstElement *src, gpointer ring, int depth, int slotSize, gpointer data);
+    static gint     SourceReadNextBlockToSlot(GstElement *src, int slot, gpointer data);
 
 private:
     ContentTypesList m_ContentTypes;
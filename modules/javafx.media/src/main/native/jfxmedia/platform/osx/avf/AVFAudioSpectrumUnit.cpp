@@ -31,6 +31,7 @@
 AVFAudioSpectrumUnit::AVFAudioSpectrumUnit() : mSpectrumCallbackProc(NULL),
                                                mSpectrumCallbackContext(NULL),
                                                mEnabled(true),
+                                               mPhasesEnabled(true),
                                                mBandCount(128),
                                                mBands(NULL),
                                                mUpdateInterval(kDefaultAudioSpectrumUpdateInterval),
@@ -166,6 +167,17 @@ void AVFAudioSpectrumUnit::SetInterval(double interval) {
     }
 }
 
+bool AVFAudioSpectrumUnit::IsPhasesEnabled() {
+    return mPhasesEnabled;
+}
+
+void AVFAudioSpectrumUnit::SetPhasesEnabled(bool isEnabled) {
+    if (mPhasesEnabled != isEnabled) {
+        mPhasesEnabled = isEnabled;
+        mRebuildCrunch = true;
+    }
+}
+
 int AVFAudioSpectrumUnit::GetThreshold() {
     return (int) mThreshold;
 }
@@ -242,14 +254,17 @@ static gboolean PostMessageCallback(GstElement * element, GstMessage * message)
         size_t bandsNum = pSpectrumUnit->GetBands();
 
         if (bandsNum > 0) {
-            float *magnitudes = new float[bandsNum];
-            float *phases = new float[bandsNum];
-
             const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
             const GValue *phases_value = gst_structure_get_value(pStr, "phase");
+
+            // "phase" is missing when phases are disabled
+            float *magnitudes = new float[bandsNum];
+            float *phases = (phases_value != NULL) ? new float[bandsNum] : NULL;
+
             for (int i = 0; i < bandsNum; i++) {
                 magnitudes[i] = g_value_get_float(gst_value_list_get_value(magnitudes_value, i));
-                phases[i] = g_value_get_float(gst_value_list_get_value(phases_value, i));
+                if (phases != NULL)
+                    phases[i] = g_value_get_float(gst_value_list_get_value(phases_value, i));
             }
             pSpectrumUnit->UpdateBands((int) bandsNum, magnitudes, phases);
 
@@ -281,7 +296,7 @@ void AVFAudioSpectrumUnit::SetupSpectralProcessor() {
     // Do send magnitude and phase information, off by default
     g_object_set(mSpectrumElement, "post-messages", TRUE,
                                    "message-magnitude", TRUE,
-                                   "message-phase", TRUE, NULL);
+                                   "message-phase", mPhasesEnabled, NULL);
 
     g_object_set(mSpectrumElement, "bands", mBandCount, NULL);
 
@@ -75,6 +75,9 @@ public:
     virtual int GetThreshold();
     virtual void SetThreshold(int threshold);
 
+    virtual bool IsPhasesEnabled();
+    virtual void SetPhasesEnabled(bool isEnabled);
+
     virtual void UpdateBands(int size, const float* magnitudes, const float* phases);
 
     void SetSampleRate(UInt32 rate);
@@ -86,6 +89,7 @@ private:
     AVFSpectrumUnitCallbackProc mSpectrumCallbackProc;
     void *mSpectrumCallbackContext;
     bool mEnabled;
+    bool mPhasesEnabled;
 
     pthread_mutex_t mBandLock;      // prevent bands from disappearing while we're processing
     int mBandCount;
@@ -241,10 +241,10 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
         return pixelBuffer;
     }
 
-    // This method is called from native [ImageBufferData::update]
-    // while lazy painting procedure
+    // This method is called from native [ImageBufferJavaBackend::update]
+    // with the rect of the pixel buffer that has been written to
     @Override
-    protected void drawPixelBuffer() {
+    protected void drawPixelBuffer(int x, int y, int w, int h) {
         PrismInvoker.invokeOnRenderThread(new Runnable() {
             public void run() {
                 //[g] field can be null if it is the first paint
@@ -252,13 +252,16 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                 Graphics g = getGraphics();
                 if (g != null && pixelBuffer != null) {
                     pixelBuffer.rewind();//critical!
-                    Image img = Image.fromByteBgraPreData(
-                            pixelBuffer,
-                            width,
-                            height);
-                    Texture txt = g.getResourceFactory().createTexture(img, Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED);
-                    g.clear();
-                    g.drawTexture(txt, 0, 0, width, height);
+                    Texture txt = g.getResourceFactory().createTexture(
+                            PixelFormat.BYTE_BGRA_PRE, Texture.Usage.DEFAULT,
+                            Texture.WrapMode.CLAMP_NOT_NEEDED, w, h);
+                    if (txt == null) {
+                        return;
+                    }
+                    txt.update(pixelBuffer, PixelFormat.BYTE_BGRA_PRE,
+                            0, 0, x, y, w, h, width * 4, false);
+                    g.setCompositeMode(CompositeMode.SRC);
+                    g.drawTexture(txt, x, y, x + w, y + h, 0, 0, w, h);
                     txt.dispose();
                 }
             }
@@ -31,6 +31,7 @@ import com.sun.javafx.font.FontResource;
 import com.sun.javafx.font.FontStrike;
 import com.sun.javafx.font.PGFont;
 import com.sun.javafx.geom.BaseBounds;
+import com.sun.javafx.geom.Shape;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.javafx.logging.PlatformLogger;
@@ -40,9 +41,12 @@ import com.sun.javafx.text.TextRun;
 import com.sun.javafx.webkit.prism.WCTextRunImpl;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.webkit.graphics.WCFont;
+import com.sun.webkit.graphics.WCPath;
 import com.sun.webkit.graphics.WCTextRun;
 import java.util.Arrays;
 import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.Map;
 import static com.sun.javafx.webkit.prism.TextUtilities.getLayoutBounds;
 import static com.sun.javafx.webkit.prism.TextUtilities.getLayoutWidth;
 
@@ -115,10 +119,28 @@ final class WCFontImpl extends WCFont {
         return getFontStrike().getFontResource().getAdvance(glyph, font.getSize());
     }
 
+    @Override public float[] getGlyphWidths(int[] glyphs) {
+        FontResource resource = getFontStrike().getFontResource();
+        float size = font.getSize();
+        float[] widths = new float[glyphs.length];
+        for (int i = 0; i < glyphs.length; i++) {
+            widths[i] = glyphs[i] != 0 ? resource.getAdvance(glyphs[i], size) : 0f;
+        }
+        return widths;
+    }
+
     @Override public float[] getGlyphBoundingBox(int glyph) {
         float[] bb = new float[4];
         bb = getFontStrike().getFontResource().getGlyphBoundingBox(glyph, font.getSize(), bb);
-        return new float[]{bb[0], -bb[3], bb[2], bb[3] - bb[1]};
+        float minY = bb[1];
+        bb[1] = -bb[3];
+        bb[3] = bb[3] - minY;
+        return bb;
+    }
+
+    @Override public WCPath getGlyphPath(int glyph) {
+        Shape outline = getFontStrike().getGlyph(glyph).getShape();
+        return outline != null ? new WCPathImpl(outline) : null;
     }
 
     @Override public float getXHeight() {
@@ -202,15 +224,40 @@ final class WCFontImpl extends WCFont {
         return getFontStrike().getMetrics().getCapHeight();
     }
 
+    // Shaped runs keyed by text. The font is implied by the owning WCFont,
+    // and the direction of each run is resolved by the layout from the text
+    // itself, so the string alone identifies the result. A font may be used
+    // by several threads, and a lookup reorders the access ordered map, so
+    // every access is guarded by the map's monitor.
+    private static final int TEXT_RUN_CACHE_SIZE = 256;
+    private final Map<String, WCTextRun[]> textRunCache =
+            new LinkedHashMap<>(16, 0.75f, true) {
+                @Override
+                protected boolean removeEldestEntry(Map.Entry<String, WCTextRun[]> eldest) {
+                    return size() > TEXT_RUN_CACHE_SIZE;
+                }
+            };
+
     @Override
     public WCTextRun[] getTextRuns(final String str) {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format("str='%s' length=%d", str, str.length()));
         }
 
-        final TextLayout layout = TextUtilities.createLayout(str, getPlatformFont());
-        return Arrays.stream(layout.getRuns())
-                     .map(WCTextRunImpl::new)
-                     .toArray(WCTextRunImpl[]::new);
+        WCTextRun[] runs;
+        synchronized (textRunCache) {
+            runs = textRunCache.get(str);
+        }
+        if (runs == null) {
+            // Shaped outside of the lock, a concurrent miss just shapes twice
+            final TextLayout layout = TextUtilities.createLayout(str, getPlatformFont());
+            runs = Arrays.stream(layout.getRuns())
+                         .map(WCTextRunImpl::new)
+                         .toArray(WCTextRunImpl[]::new);
+            synchronized (textRunCache) {
+                textRunCache.put(str, runs);
+            }
+        }
+        return runs;
     }
 }
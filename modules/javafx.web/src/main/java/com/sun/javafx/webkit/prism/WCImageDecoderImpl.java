@@ -33,6 +33,7 @@ import com.sun.javafx.iio.ImageStorage;
 import com.sun.javafx.iio.ImageStorageException;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.javafx.tk.Toolkit;
 import com.sun.webkit.graphics.WCGraphicsManager;
 import com.sun.webkit.graphics.WCImage;
 import com.sun.webkit.graphics.WCImageDecoder;
@@ -40,7 +41,7 @@ import com.sun.webkit.graphics.WCImageFrame;
 import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
-import java.util.Arrays;
+import java.nio.ByteBuffer;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
 
@@ -48,18 +49,18 @@ final class WCImageDecoderImpl extends WCImageDecoder {
 
     private final static PlatformLogger log;
 
-    private Service<ImageFrame[]> loader;
+    private volatile Service<ImageFrame[]> loader;
 
     private int imageWidth = 0;
     private int imageHeight = 0;
-    private ImageFrame[] frames;
+    private volatile ImageFrame[] frames;
     private int frameCount = 0; // keeps frame count when decoded frames are temporarily destroyed
-    private boolean fullDataReceived = false;
+    private volatile boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
     private PrismImage[] images;
     private volatile byte[] data;
     private volatile int dataSize = 0;
-    private String fileNameExtension;
+    private volatile String fileNameExtension;
 
     static {
         log = PlatformLogger.getLogger(WCImageDecoderImpl.class.getName());
@@ -82,6 +83,25 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         framesDecoded = false;
     }
 
+    @Override protected synchronized void destroyDecodedFrames() {
+        // Animated images would have to decode all the frames again
+        if (fullDataReceived && framesDecoded && frameCount <= 1) {
+            if (log.isLoggable(Level.FINE)) {
+                log.fine(String.format("%X Destroy decoded frames", hashCode()));
+            }
+            frames = null;
+            images = null;
+            framesDecoded = false;
+        }
+    }
+
+    // Only GIF images may have several frames, other formats can be decoded
+    // on demand without decoding them to find out the frame count.
+    private boolean isSingleFrameFormat() {
+        String extension = fileNameExtension;
+        return extension != null && !"gif".equalsIgnoreCase(extension);
+    }
+
     @Override protected String getFilenameExtension() {
         return "." + fileNameExtension;
     }
@@ -90,20 +110,18 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return imageWidth > 0 && imageHeight > 0;
     }
 
-    @Override protected void addImageData(byte[] dataPortion) {
+    @Override protected void addImageData(ByteBuffer dataPortion) {
         if (dataPortion != null) {
             fullDataReceived = false;
+            int length = dataPortion.remaining();
             if (data == null) {
-                data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
-                dataSize = dataPortion.length;
-            } else {
-                int newDataSize = dataSize + dataPortion.length;
-                if (newDataSize > data.length) {
-                    resizeDataArray(Math.max(newDataSize, data.length * 2));
-                }
-                System.arraycopy(dataPortion, 0, data, dataSize, dataPortion.length);
-                dataSize = newDataSize;
+                data = new byte[length * 2];
+                dataSize = 0;
+            } else if (dataSize + length > data.length) {
+                resizeDataArray(Math.max(dataSize + length, data.length * 2));
             }
+            dataPortion.get(data, dataSize, length);
+            dataSize += length;
             // Try to decode the partial data until we get image size.
             if (!imageSizeAvilable()) {
                 loadFrames();
@@ -126,7 +144,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
 
     private void startLoader() {
         if (this.loader == null) {
-            this.loader = new Service<ImageFrame[]>() {
+            final Service<ImageFrame[]> service = new Service<ImageFrame[]>() {
                 protected Task<ImageFrame[]> createTask() {
                     return new Task<ImageFrame[]>() {
                         protected ImageFrame[] call() throws Exception {
@@ -135,11 +153,13 @@ final class WCImageDecoderImpl extends WCImageDecoder {
                     };
                 }
             };
-            this.loader.valueProperty().addListener((ov, old, frames) -> {
-                if ((frames != null) && (loader != null)) {
+            // an abandoned service may still deliver a stale partial decode
+            service.valueProperty().addListener((ov, old, frames) -> {
+                if ((frames != null) && (loader == service)) {
                     setFrames(frames);
                 }
             });
+            this.loader = service;
         }
         if (!this.loader.isRunning()) {
             this.loader.restart();
@@ -172,14 +192,21 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     }
 
     private synchronized ImageFrame[] loadFrames(InputStream in) {
-        if (log.isLoggable(Level.FINE)) {
-            log.fine(String.format("%X Decoding frames", hashCode()));
+        final boolean logDecoding = log.isLoggable(Level.FINE);
+        final long start = logDecoding ? System.nanoTime() : 0;
+        if (logDecoding) {
+            log.fine(String.format("%X Decoding frames on %s", hashCode(),
+                    Thread.currentThread().getName()));
         }
         try {
             return ImageStorage.loadAll(in, readerListener, 0, 0, true, 1.0f, false);
         } catch (ImageStorageException e) {
             return null; // consider image missing
         } finally {
+            if (logDecoding) {
+                log.fine(String.format("%X Decoded frames in %d us", hashCode(),
+                        (System.nanoTime() - start) / 1000));
+            }
             try {
                 in.close();
             } catch (IOException e) {
@@ -261,6 +288,11 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         // be any performance degrade while initiating a
         // full decode.
         if (fullDataReceived) {
+            if (isSingleFrameFormat()) {
+                // Leave the decoding to getFrame, which may then be called
+                // on an asynchronous decoding thread
+                return 1;
+            }
             getImageFrame(0);
         }
         return frameCount;
@@ -285,7 +317,10 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return null;
     }
 
-    private synchronized ImageMetadata getFrameMetadata(int idx) {
+    // Not synchronized, so that the frame properties can be queried while
+    // frames are being decoded on another thread
+    private ImageMetadata getFrameMetadata(int idx) {
+        final ImageFrame[] frames = this.frames;
         return frames != null && frames.length > idx && frames[idx] != null ? frames[idx].getMetadata() : null;
     }
 
@@ -317,15 +352,35 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return size;
     }
 
-    @Override protected synchronized boolean getFrameCompleteStatus(int idx) {
+    @Override protected boolean getFrameCompleteStatus(int idx) {
+        if (fullDataReceived && isSingleFrameFormat()) {
+            return idx == 0;
+        }
         // For GIF images there is no better way to find whether a given frame
         // is completely decoded or not. As of now relying on framesDecoded
         // which will wait for all the frames to decode.
-        return getFrameMetadata(idx) != null && framesDecoded;
+        synchronized (this) {
+            return getFrameMetadata(idx) != null && framesDecoded;
+        }
     }
 
     private synchronized ImageFrame getImageFrame(int idx) {
-        if (!fullDataReceived) {
+        if (!Toolkit.getToolkit().isFxUserThread()) {
+            // Called from WebCore's asynchronous image decoding thread, where
+            // the loader Service must not be used. Decode in place instead:
+            // the complete image once all data has arrived, otherwise just
+            // what has been received so far, leaving the loader alone.
+            if (!framesDecoded) {
+                ImageFrame[] decoded = loadFrames();
+                if (fullDataReceived) {
+                    loader = null; // let a running partial decode finish unused
+                    setFrames(decoded);
+                    framesDecoded = true;
+                } else if (decoded != null) {
+                    setFrames(decoded);
+                }
+            }
+        } else if (!fullDataReceived) {
             startLoader();
         } else if (fullDataReceived && !framesDecoded) {
             destroyLoader();
@@ -32,6 +32,7 @@ import com.sun.javafx.geom.PathIterator;
 import com.sun.javafx.geom.Point2D;
 import com.sun.javafx.geom.RectBounds;
 import com.sun.javafx.geom.RoundRectangle2D;
+import com.sun.javafx.geom.Shape;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.webkit.graphics.WCPath;
 import com.sun.webkit.graphics.WCPathIterator;
@@ -64,6 +65,14 @@ final class WCPathImpl extends WCPath<Path2D> {
         hasCP = wcp.hasCP;
     }
 
+    WCPathImpl(Shape shape) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("Create WCPathImpl({0}) from shape", getID());
+        }
+        path = new Path2D(shape);
+        hasCP = path.getNumCommands() > 0;
+    }
+
     public void addRect(double x, double y, double w, double h) {
         if (log.isLoggable(Level.FINE)) {
             log.fine("WCPathImpl({0}).addRect({1},{2},{3},{4})",
@@ -239,6 +248,44 @@ final class WCPathImpl extends WCPath<Path2D> {
         path.closePath();
     }
 
+    public void addSegments(int[] types, float[] coords) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("WCPathImpl({0}).addSegments({1})",
+                    new Object[] {getID(), types.length});
+        }
+        int i = 0;
+        for (int type : types) {
+            switch (type) {
+                case WCPathIterator.SEG_MOVETO:
+                    path.moveTo(coords[i], coords[i + 1]);
+                    i += 2;
+                    hasCP = true;
+                    break;
+                case WCPathIterator.SEG_LINETO:
+                    path.lineTo(coords[i], coords[i + 1]);
+                    i += 2;
+                    hasCP = true;
+                    break;
+                case WCPathIterator.SEG_QUADTO:
+                    path.quadTo(coords[i], coords[i + 1],
+                                coords[i + 2], coords[i + 3]);
+                    i += 4;
+                    hasCP = true;
+                    break;
+                case WCPathIterator.SEG_CUBICTO:
+                    path.curveTo(coords[i], coords[i + 1],
+                                 coords[i + 2], coords[i + 3],
+                                 coords[i + 4], coords[i + 5]);
+                    i += 6;
+                    hasCP = true;
+                    break;
+                case WCPathIterator.SEG_CLOSE:
+                    path.closePath();
+                    break;
+            }
+        }
+    }
+
     public boolean isEmpty() {
         return !hasCP;
     }
@@ -30,52 +30,32 @@ import com.sun.javafx.text.TextRun;
 import com.sun.webkit.graphics.WCTextRun;
 
 public final class WCTextRunImpl implements WCTextRun {
-    private final TextRun run;
-
-    public WCTextRunImpl(GlyphList run) {
-        this.run = (TextRun) run;
-    }
-
-    @Override
-    public int getGlyphCount() {
-        return run.getGlyphCount();
-    }
-
-    @Override
-    public boolean isLeftToRight() {
-        return run.isLeftToRight();
-    }
-
-    @Override
-    public int getGlyph(int index) {
-        return index < run.getGlyphCount() ? run.getGlyphCode(index) : 0;
-    }
-
-    // Avoid repeated allocation
-    private static float POS_AND_ADVANCE[] = new float[4];
-
-    @Override
-    public float[] getGlyphPosAndAdvance(int glyphIndex) {
-        POS_AND_ADVANCE[0] = run.getPosX(glyphIndex);
-        POS_AND_ADVANCE[1] = run.getPosY(glyphIndex);
-        POS_AND_ADVANCE[2] = run.getAdvance(glyphIndex);
-        // FIXME: We don't yet support Y advance from prism.
-        POS_AND_ADVANCE[3] = 0;
-        return POS_AND_ADVANCE;
-    }
-
-    @Override
-    public int getStart() {
-        return run.getStart();
-    }
-
-    @Override
-    public int getEnd() {
-        return run.getEnd();
+    private final int[] data;
+
+    public WCTextRunImpl(GlyphList glyphList) {
+        TextRun run = (TextRun) glyphList;
+        int glyphCount = run.getGlyphCount();
+        data = new int[HEADER_SIZE + glyphCount * GLYPH_SIZE];
+        data[FLAGS] = run.isLeftToRight() ? FLAG_LEFT_TO_RIGHT : 0;
+        data[START] = run.getStart();
+        data[END] = run.getEnd();
+        data[GLYPH_COUNT] = glyphCount;
+        if (glyphCount > 0) {
+            // Prism does not expose the initial advance of a run, glyph 0's
+            // position is used in its place.
+            data[INITIAL_ADVANCE_X] = Float.floatToRawIntBits(run.getPosX(0));
+            data[INITIAL_ADVANCE_Y] = Float.floatToRawIntBits(run.getPosY(0));
+        }
+        for (int i = 0, j = HEADER_SIZE; i < glyphCount; i++, j += GLYPH_SIZE) {
+            data[j + GLYPH_CODE] = run.getGlyphCode(i);
+            data[j + GLYPH_CHAR_OFFSET] = run.getCharOffset(i);
+            // FIXME: We don't yet support Y advance from prism.
+            data[j + GLYPH_ADVANCE] = Float.floatToRawIntBits(run.getAdvance(i));
+        }
     }
 
     @Override
-    public int getCharOffset(int index) {
-        return run.getCharOffset(index);
+    public int[] getGlyphData() {
+        return data;
     }
 }
@@ -51,6 +51,7 @@ import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.HashSet;
 import java.util.Iterator;
+import java.util.LinkedHashMap;
 import java.util.LinkedList;
 import java.util.List;
 import java.util.Map;
@@ -84,6 +85,21 @@ public final class WebPage {
 
     private static final int MAX_FRAME_QUEUE_SIZE = 10;
 
+    // Size of the tiles whose render queues are kept as display lists
+    private static final int TILE_SIZE = 256;
+    // Maximum total size of the recorded render queues, in bytes
+    private static final int MAX_TILE_BYTES = 32 * 1024 * 1024;
+    // Maximum number of tiles recorded by a single prepaint task
+    private static final int MAX_PREPAINT_TILES = 2;
+
+    // Whether render queues painted for whole document tiles are kept and
+    // decoded again, instead of repainting, while the tile content does not
+    // change. Scrolling then composes recorded tiles at the new offset.
+    private static final boolean useTileRecordings =
+            AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+                    Boolean.valueOf(System.getProperty(
+                            "com.sun.webkit.useTileRecordings", "false")));
+
     // Native WebPage* pointer
     private long pPage = 0;
 
@@ -126,6 +142,37 @@ public final class WebPage {
     // Accessed on: Event thread only.
     private RenderFrame currentFrame = new RenderFrame();
 
+    // Recorded tiles, in access order, keyed by document tile index.
+    // Accessed on: Event thread only.
+    private final Map<Long, TileRecording> tileRecordings =
+            new LinkedHashMap<Long, TileRecording>(16, 0.75f, true);
+    private int tileBytes;
+
+    // Incremented whenever recorded tiles are invalidated.
+    // Accessed on: Event thread only.
+    private int tileInvalidationCount;
+
+    // Tiles invalidated since the last run of prepaint tasks ended. They are
+    // not recorded by the next run, so that content repainted again and
+    // again, like a blinking caret, is not recorded each time.
+    // Accessed on: Event thread only.
+    private final Set<Long> invalidatedTiles = new HashSet<Long>();
+
+    // Tiles replayed and rects painted for the frames since the last log
+    // message. Accessed on: Event thread only.
+    private int tilesReplayed, rectsPainted;
+
+    // Main frame state the recorded tiles are valid for, as returned by
+    // twkGetTileState: scroll position, visible and contents sizes, whether
+    // there is fixed positioned content, and the layout generation.
+    // Accessed on: Event thread only.
+    private int scrollX, scrollY;
+    private int visibleWidth, visibleHeight;
+    private int contentsWidth, contentsHeight;
+    private boolean hasFixedContent;
+    private int tileGeneration;
+    private boolean prepaintScheduled;
+
     // An ID of the current updateContent cycle associated with an updateContent call.
     private int updateContentCycleID;
 
@@ -315,17 +362,19 @@ public final class WebPage {
         List<WCRectangle> oldDirtyRects = dirtyRects;
         dirtyRects = new LinkedList<WCRectangle>();
         twkPrePaint(getPage());
+        if (useTileRecordings) {
+            refreshTileState();
+        }
         while (!oldDirtyRects.isEmpty()) {
             WCRectangle r = oldDirtyRects.remove(0).intersection(clip);
             if (r.getWidth() <= 0 || r.getHeight() <= 0) {
                 continue;
             }
-            paintLog.finest("Updating: {0}", r);
-            WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
-                    .createRenderQueue(r, true);
-            twkUpdateContent(getPage(), rq, r.getIntX() - 1, r.getIntY() - 1,
-                             r.getIntWidth() + 2, r.getIntHeight() + 2);
-            currentFrame.addRenderQueue(rq);
+            if (useTileRecordings) {
+                updateTiles(r, clip);
+            } else {
+                currentFrame.addRenderQueue(paintDirtyRect(r));
+            }
         }
         {
             WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
@@ -341,23 +390,50 @@ public final class WebPage {
                     new Object[] {dirtyRects, currentFrame});
         }
 
-        if (currentFrame.getRQList().size() > 0) {
+        if (paintLog.isLoggable(Level.FINE)) {
+            int bytes = 0;
+            for (WCRenderQueue rq : currentFrame.getRQList()) {
+                bytes += rq.getSize();
+            }
+            paintLog.fine("Frame encoded {0} bytes in {1} render queues, "
+                    + "{2} native buffers in flight",
+                    new Object[] {bytes, currentFrame.getRQList().size(),
+                            WCRenderQueue.getBuffersInFlight()});
+            if (useTileRecordings) {
+                paintLog.fine("Frame replayed {0} recorded tiles, painted "
+                        + "{1} rects, {2} tiles ({3} bytes) recorded",
+                        new Object[] {tilesReplayed, rectsPainted,
+                                tileRecordings.size(), tileBytes});
+                tilesReplayed = 0;
+                rectsPainted = 0;
+            }
+
+            int[] encoded = new int[GraphicsDecoder.OPCODE_COUNT];
+            int[] elided = new int[GraphicsDecoder.OPCODE_COUNT];
+            int bytesElided = WCRenderQueue.getStateCounters(encoded, elided);
+            StringBuilder counters = new StringBuilder();
+            for (int op = 0; op < GraphicsDecoder.OPCODE_COUNT; op++) {
+                if (encoded[op] != 0 || elided[op] != 0) {
+                    counters.append(' ').append(op).append(':')
+                            .append(encoded[op]).append('/').append(elided[op]);
+                }
+            }
+            paintLog.fine("Frame state commands (opcode:encoded/elided){0}, "
+                    + "{1} bytes elided",
+                    new Object[] {counters, bytesElided});
+        }
+
+        if (!currentFrame.isEmpty()) {
             synchronized (frameQueue) {
                 paintLog.finest("About to update frame queue, frameQueue: {0}", frameQueue);
 
                 Iterator<RenderFrame> it = frameQueue.iterator();
                 while (it.hasNext()) {
                     RenderFrame frame = it.next();
-                    for (WCRenderQueue rq : currentFrame.getRQList()) {
-                        WCRectangle rqRect = rq.getClip();
-                        if (rq.isOpaque()
-                                && rqRect.contains(frame.getEnclosingRect()))
-                        {
-                            paintLog.finest("Dropping: {0}", frame);
-                            frame.drop();
-                            it.remove();
-                            break;
-                        }
+                    if (currentFrame.covers(frame.getEnclosingRect())) {
+                        paintLog.finest("Dropping: {0}", frame);
+                        frame.drop();
+                        it.remove();
                     }
                 }
 
@@ -375,17 +451,321 @@ public final class WebPage {
             }
         }
 
+        if (useTileRecordings) {
+            schedulePrepaint();
+        }
+
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Exiting, dirtyRects: {0}, currentFrame: {1}",
                     new Object[] {dirtyRects, currentFrame});
         }
     }
 
+    private WCRenderQueue paintDirtyRect(WCRectangle r) {
+        paintLog.finest("Updating: {0}", r);
+        rectsPainted++;
+        WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
+                .createRenderQueue(r, true);
+        twkUpdateContent(getPage(), rq, r.getIntX() - 1, r.getIntY() - 1,
+                         r.getIntWidth() + 2, r.getIntHeight() + 2);
+        return rq;
+    }
+
+    // Paints a document rect of the main frame, for recording.
+    private WCRenderQueue paintTile(WCRectangle tile) {
+        paintLog.finest("Updating tile: {0}", tile);
+        WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
+                .createRenderQueue(tile, true);
+        twkUpdateTile(getPage(), rq, tile.getIntX(), tile.getIntY(),
+                      tile.getIntWidth(), tile.getIntHeight());
+        return rq;
+    }
+
+    // Called on: Event thread only
+    private void refreshTileState() {
+        int[] state = twkGetTileState(getPage());
+        if (state == null) {
+            invalidateTileRecordings();
+            return;
+        }
+        boolean scrolled = state[0] != scrollX || state[1] != scrollY;
+        scrollX = state[0];
+        scrollY = state[1];
+        visibleWidth = state[2];
+        visibleHeight = state[3];
+        contentsWidth = state[4];
+        contentsHeight = state[5];
+        hasFixedContent = state[6] != 0;
+        if (scrolled && hasFixedContent) {
+            // Fixed positioned content moves within the document
+            invalidateTileRecordings();
+        }
+        if (state[7] != tileGeneration) {
+            tileGeneration = state[7];
+            // WebCore repaints only what is visible after a style change or
+            // a layout, so the tiles outside of the viewport may be stale
+            WCRectangle visible = new WCRectangle(scrollX, scrollY,
+                                                  visibleWidth, visibleHeight);
+            for (Iterator<TileRecording> it = tileRecordings.values().iterator(); it.hasNext();) {
+                TileRecording recording = it.next();
+                if (!visible.contains(recording.getClip())) {
+                    it.remove();
+                    removeTileRecording(recording);
+                }
+            }
+        }
+    }
+
+    // Returns the visible part of the main frame contents in view
+    // coordinates, that is without the scrollbars.
+    private WCRectangle getContentsView() {
+        return new WCRectangle(0, 0,
+                Math.min(visibleWidth, contentsWidth - scrollX),
+                Math.min(visibleHeight, contentsHeight - scrollY));
+    }
+
+    private static long tileKey(int tx, int ty) {
+        return ((long) tx << 32) | (ty & 0xFFFFFFFFL);
+    }
+
+    // Called on: Event thread only
+    private TileRecording getTileRecording(int tx, int ty, WCRectangle tile) {
+        Long key = tileKey(tx, ty);
+        TileRecording recording = tileRecordings.get(key);
+        if (recording != null && !recording.getClip().equals(tile)) {
+            // The contents size changed
+            tileRecordings.remove(key);
+            removeTileRecording(recording);
+            recording = null;
+        }
+        return recording;
+    }
+
+    // Called on: Event thread only
+    private TileRecording recordTile(int tx, int ty, WCRectangle tile) {
+        int invalidations = tileInvalidationCount;
+        WCRenderQueue rq = paintTile(tile);
+        if (invalidations != tileInvalidationCount || rq.isEmpty()) {
+            // The content changed while it was painted, or could not be
+            // painted because of a pending layout
+            rq.dispose();
+            return null;
+        }
+        TileRecording recording = new TileRecording(rq);
+        tileRecordings.put(tileKey(tx, ty), recording);
+        tileBytes += recording.getSize();
+        for (Iterator<TileRecording> it = tileRecordings.values().iterator();
+                tileBytes > MAX_TILE_BYTES && it.hasNext();)
+        {
+            TileRecording eldest = it.next();
+            if (eldest != recording) {
+                it.remove();
+                removeTileRecording(eldest);
+            }
+        }
+        return recording;
+    }
+
+    // Called on: Event thread only
+    private void removeTileRecording(TileRecording recording) {
+        tileBytes -= recording.getSize();
+        recording.release();
+    }
+
+    // The dirty rect is split into the document tiles of the main frame.
+    // Tiles that have a recording are decoded again at the current scroll
+    // offset. The rest of the dirty rect, including the scrollbars, is
+    // painted with a single FrameView::paint as usual, so a dirty rect
+    // never costs more than it does without recordings. Tiles are recorded
+    // only by the prepaint task, off the paint path.
+    private void updateTiles(WCRectangle r, WCRectangle clip) {
+        WCRectangle contentsView = getContentsView().intersection(clip);
+        WCRectangle rc = r.intersection(contentsView);
+        if (rc.isEmpty() || tileRecordings.isEmpty()) {
+            currentFrame.addRenderQueue(paintDirtyRect(r));
+            return;
+        }
+        // The parts outside of the contents
+        int x0 = r.getIntX(), x1 = x0 + r.getIntWidth();
+        int cx0 = rc.getIntX(), cx1 = cx0 + rc.getIntWidth();
+        int cy0 = rc.getIntY(), cy1 = cy0 + rc.getIntHeight();
+        WCRectangle[] strips = {
+            new WCRectangle(x0, r.getIntY(), r.getIntWidth(), cy0 - r.getIntY()),
+            new WCRectangle(x0, cy1, r.getIntWidth(),
+                            r.getIntY() + r.getIntHeight() - cy1),
+            new WCRectangle(x0, cy0, cx0 - x0, rc.getIntHeight()),
+            new WCRectangle(cx1, cy0, x1 - cx1, rc.getIntHeight()),
+        };
+        WCRectangle unrecorded = new WCRectangle();
+        for (WCRectangle strip : strips) {
+            if (!strip.isEmpty()) {
+                unionRect(unrecorded, strip);
+            }
+        }
+
+        WCRectangle contents = new WCRectangle(0, 0, contentsWidth, contentsHeight);
+        List<TileReplay> replays = new ArrayList<TileReplay>();
+        int tx0 = (cx0 + scrollX) / TILE_SIZE;
+        int ty0 = (cy0 + scrollY) / TILE_SIZE;
+        int tx1 = (cx1 + scrollX - 1) / TILE_SIZE;
+        int ty1 = (cy1 + scrollY - 1) / TILE_SIZE;
+        for (int ty = ty0; ty <= ty1; ty++) {
+            for (int tx = tx0; tx <= tx1; tx++) {
+                WCRectangle tile = new WCRectangle(tx * TILE_SIZE,
+                        ty * TILE_SIZE, TILE_SIZE, TILE_SIZE).intersection(contents);
+                WCRectangle tileView = new WCRectangle(tile.getX() - scrollX,
+                        tile.getY() - scrollY, tile.getWidth(), tile.getHeight())
+                        .intersection(contentsView);
+                if (tileView.isEmpty()) {
+                    continue;
+                }
+                TileRecording recording = getTileRecording(tx, ty, tile);
+                WCRectangle dirty = tileView.intersection(rc);
+                if (recording != null) {
+                    replays.add(new TileReplay(recording, dirty, scrollX, scrollY));
+                } else {
+                    unionRect(unrecorded, dirty);
+                }
+            }
+        }
+
+        if (!unrecorded.isEmpty()) {
+            currentFrame.addRenderQueue(paintDirtyRect(unrecorded));
+        }
+        // The recordings show the same content as the painted rect, so it
+        // does not matter that the rect may overlap them
+        for (TileReplay replay : replays) {
+            currentFrame.addTileReplay(replay);
+            tilesReplayed++;
+        }
+    }
+
+    private static void unionRect(WCRectangle dst, WCRectangle r) {
+        if (dst.isEmpty()) {
+            dst.setFrame(r.getX(), r.getY(), r.getWidth(), r.getHeight());
+        } else {
+            WCRectangle.union(dst, r, dst);
+        }
+    }
+
+    // Schedules recording of the tiles around the viewport once the pending
+    // events are processed, so that they can be composed when scrolling.
+    // Called on: Event thread only
+    private void schedulePrepaint() {
+        if (prepaintScheduled || !dirtyRects.isEmpty() || hasFixedContent
+                || tileBytes > MAX_TILE_BYTES / 4 * 3)
+        {
+            return;
+        }
+        prepaintScheduled = true;
+        Invoker.getInvoker().postOnEventThread(this::prepaintTiles);
+    }
+
+    // Called on: Event thread only
+    private void prepaintTiles() {
+        lockPage();
+        try {
+            prepaintScheduled = false;
+            if (isDisposed || !dirtyRects.isEmpty()) {
+                return;
+            }
+            int generation = tileGeneration;
+            refreshTileState();
+            if (generation != tileGeneration || hasFixedContent) {
+                // Wait until the content is stable
+                return;
+            }
+            WCRectangle contents = new WCRectangle(0, 0, contentsWidth, contentsHeight);
+            // Tiles within the viewport are on screen already, the ones
+            // that a scroll may expose are recorded
+            WCRectangle visible = new WCRectangle(scrollX, scrollY,
+                                                  visibleWidth, visibleHeight);
+            WCRectangle area = new WCRectangle(scrollX - TILE_SIZE,
+                    scrollY - TILE_SIZE, visibleWidth + 2 * TILE_SIZE,
+                    visibleHeight + 2 * TILE_SIZE).intersection(contents);
+            if (area.isEmpty()) {
+                return;
+            }
+            int tx0 = area.getIntX() / TILE_SIZE;
+            int ty0 = area.getIntY() / TILE_SIZE;
+            int tx1 = (area.getIntX() + area.getIntWidth() - 1) / TILE_SIZE;
+            int ty1 = (area.getIntY() + area.getIntHeight() - 1) / TILE_SIZE;
+            int painted = 0;
+            for (int ty = ty0; ty <= ty1 && painted < MAX_PREPAINT_TILES; ty++) {
+                for (int tx = tx0; tx <= tx1 && painted < MAX_PREPAINT_TILES; tx++) {
+                    WCRectangle tile = new WCRectangle(tx * TILE_SIZE,
+                            ty * TILE_SIZE, TILE_SIZE, TILE_SIZE).intersection(contents);
+                    if (!visible.contains(tile)
+                            && !invalidatedTiles.contains(tileKey(tx, ty))
+                            && getTileRecording(tx, ty, tile) == null)
+                    {
+                        if (recordTile(tx, ty, tile) == null) {
+                            // Not tried again before the page is painted again
+                            invalidatedTiles.add(tileKey(tx, ty));
+                        }
+                        painted++;
+                    }
+                }
+            }
+            if (painted > 0) {
+                schedulePrepaint();
+            } else {
+                invalidatedTiles.clear();
+            }
+        } finally {
+            unlockPage();
+        }
+    }
+
+    // Invalidates the recorded tiles intersecting a rect in view coordinates.
+    // Called on: Event thread only
+    private void invalidateTileRecordings(WCRectangle r) {
+        tileInvalidationCount++;
+        WCRectangle doc = new WCRectangle(r.getX() + scrollX, r.getY() + scrollY,
+                                          r.getWidth(), r.getHeight());
+        if (!doc.isEmpty()) {
+            int tx1 = (doc.getIntX() + doc.getIntWidth() - 1) / TILE_SIZE;
+            int ty1 = (doc.getIntY() + doc.getIntHeight() - 1) / TILE_SIZE;
+            for (int ty = Math.max(doc.getIntY(), 0) / TILE_SIZE; ty <= ty1; ty++) {
+                for (int tx = Math.max(doc.getIntX(), 0) / TILE_SIZE; tx <= tx1; tx++) {
+                    invalidatedTiles.add(tileKey(tx, ty));
+                }
+            }
+        }
+        for (Iterator<TileRecording> it = tileRecordings.values().iterator(); it.hasNext();) {
+            TileRecording recording = it.next();
+            if (!recording.getClip().intersection(doc).isEmpty()) {
+                it.remove();
+                removeTileRecording(recording);
+            }
+        }
+    }
+
+    // Called on: Event thread only
+    private void invalidateTileRecordings() {
+        tileInvalidationCount++;
+        for (TileRecording recording : tileRecordings.values()) {
+            recording.release();
+        }
+        tileRecordings.clear();
+        tileBytes = 0;
+    }
+
     private void scroll(int x, int y, int w, int h, int dx, int dy) {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("rect=[" + x + ", " + y + " " + w + "x" + h +
                             "] delta=[" + dx + ", " + dy + "]");
         }
+        if (useTileRecordings) {
+            int oldScrollX = scrollX;
+            int oldScrollY = scrollY;
+            refreshTileState();
+            if (scrollX - oldScrollX != -dx || scrollY - oldScrollY != -dy) {
+                // Not the main frame scrolling, the document content of the
+                // scrolled rect changes
+                invalidateTileRecordings(new WCRectangle(x, y, w, h));
+            }
+        }
         dx += currentFrame.scrollDx;
         dy += currentFrame.scrollDy;
 
@@ -438,6 +818,11 @@ public final class WebPage {
     private static final class RenderFrame {
         private final List<WCRenderQueue> rqList =
                 new LinkedList<WCRenderQueue>();
+        private final List<TileReplay> tileList =
+                new LinkedList<TileReplay>();
+        // Position in rqList at which the tiles are rendered, so that they
+        // come after a preceding COPYREGION and before the post paint
+        private int tilePosition = -1;
         private int scrollDx, scrollDy;
         private final WCRectangle enclosingRect = new WCRectangle();
 
@@ -447,7 +832,21 @@ public final class WebPage {
                 return;
             }
             rqList.add(rq);
-            WCRectangle rqRect = rq.getClip();
+            addRect(rq.getClip());
+        }
+
+        // Called on: Event thread only
+        private void addTileReplay(TileReplay replay) {
+            if (tileList.isEmpty()) {
+                tilePosition = rqList.size();
+            }
+            replay.recording.retain();
+            tileList.add(replay);
+            addRect(replay.clip);
+        }
+
+        // Called on: Event thread only
+        private void addRect(WCRectangle rqRect) {
             if (enclosingRect.isEmpty()) {
                 enclosingRect.setFrame(rqRect.getX(), rqRect.getY(),
                                        rqRect.getWidth(), rqRect.getHeight());
@@ -463,6 +862,57 @@ public final class WebPage {
             return rqList;
         }
 
+        // Called on: Main thread only
+        private void render(WCGraphicsContext gc) {
+            int i = 0;
+            for (WCRenderQueue rq : rqList) {
+                if (i++ == tilePosition) {
+                    renderTiles(gc);
+                }
+                gc.saveState();
+                if (rq.getClip() != null) {
+                    gc.setClip(rq.getClip());
+                }
+                rq.decode(gc);
+                gc.restoreState();
+            }
+            if (tilePosition == rqList.size()) {
+                renderTiles(gc);
+            }
+        }
+
+        // Called on: Main thread only
+        private void renderTiles(WCGraphicsContext gc) {
+            for (TileReplay replay : tileList) {
+                gc.saveState();
+                gc.setClip(replay.clip);
+                gc.translate(-replay.scrollX, -replay.scrollY);
+                replay.recording.replay(gc, -replay.scrollX, -replay.scrollY);
+                gc.restoreState();
+                replay.recording.release();
+            }
+        }
+
+        // Called on: Event thread only
+        private boolean isEmpty() {
+            return rqList.isEmpty() && tileList.isEmpty();
+        }
+
+        // Called on: Event thread only
+        private boolean covers(WCRectangle rect) {
+            for (WCRenderQueue rq : rqList) {
+                if (rq.isOpaque() && rq.getClip().contains(rect)) {
+                    return true;
+                }
+            }
+            for (TileReplay replay : tileList) {
+                if (replay.clip.contains(rect)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         // Called on: Event thread only
         private WCRectangle getEnclosingRect() {
             return enclosingRect;
@@ -474,6 +924,11 @@ public final class WebPage {
                 rq.dispose();
             }
             rqList.clear();
+            for (TileReplay replay : tileList) {
+                replay.recording.release();
+            }
+            tileList.clear();
+            tilePosition = -1;
             enclosingRect.setFrame(0, 0, 0, 0);
             scrollDx = 0;
             scrollDy = 0;
@@ -483,11 +938,79 @@ public final class WebPage {
         public String toString() {
             return "RenderFrame{"
                     + "rqList=" + rqList + ", "
+                    + "tileList=" + tileList + ", "
                     + "enclosingRect=" + enclosingRect
                     + "}";
         }
     }
 
+    // A render queue painted for a whole document tile. It is decoded every
+    // time the tile is repainted, and disposed once it is neither recorded
+    // nor referenced by a render frame.
+    private static final class TileRecording {
+        private final WCRenderQueue rq;
+        private final int size;
+        private int holders = 1;
+
+        private TileRecording(WCRenderQueue rq) {
+            this.rq = rq;
+            this.size = rq.getSize();
+        }
+
+        // Returns the tile rect in document coordinates
+        private WCRectangle getClip() {
+            return rq.getClip();
+        }
+
+        private int getSize() {
+            return size;
+        }
+
+        // Called on: Main thread only
+        private void replay(WCGraphicsContext gc, int x, int y) {
+            rq.replay(gc, x, y);
+        }
+
+        // Called on: Event thread only
+        private synchronized void retain() {
+            holders++;
+        }
+
+        // Called on: Event thread and Main thread
+        private synchronized void release() {
+            if (--holders == 0) {
+                rq.dispose();
+            }
+        }
+
+        @Override
+        public String toString() {
+            return "TileRecording{" + rq.getClip() + "}";
+        }
+    }
+
+    // A recorded tile decoded for a dirty rect in view coordinates, at the
+    // scroll position of the frame it belongs to.
+    private static final class TileReplay {
+        private final TileRecording recording;
+        private final WCRectangle clip;
+        private final int scrollX, scrollY;
+
+        private TileReplay(TileRecording recording, WCRectangle clip,
+                           int scrollX, int scrollY)
+        {
+            this.recording = recording;
+            this.clip = clip;
+            this.scrollX = scrollX;
+            this.scrollY = scrollY;
+        }
+
+        @Override
+        public String toString() {
+            return "TileReplay{" + recording + " at " + clip + "}";
+        }
+    }
+
     // *************************************************************************
     // Callback API
     // *************************************************************************
@@ -571,6 +1094,7 @@ public final class WebPage {
             // view.
             // We workaround this problem by invalidating the entire
             // visible area here.
+            invalidateTileRecordings();
             repaintAll();
 
         } finally {
@@ -746,14 +1270,7 @@ public final class WebPage {
 
         for (RenderFrame frame : framesToRender) {
             paintLog.finest("Rendering: {0}", frame);
-            for (WCRenderQueue rq : frame.getRQList()) {
-                gc.saveState();
-                if (rq.getClip() != null) {
-                    gc.setClip(rq.getClip());
-                }
-                rq.decode(gc);
-                gc.restoreState();
-            }
+            frame.render(gc);
         }
         paintLog.finest("Exiting");
     }
@@ -1029,6 +1546,7 @@ public final class WebPage {
 
             stop();
             dropRenderFrames();
+            invalidateTileRecordings();
             isDisposed = true;
 
             twkDestroyPage(pPage);
@@ -1175,6 +1693,7 @@ public final class WebPage {
 
     // DRT support
     public void forceRepaint() {
+        invalidateTileRecordings();
         repaintAll();
         updateContent(new WCRectangle(0, 0, width, height));
     }
@@ -2133,7 +2652,15 @@ public final class WebPage {
                 paintLog.finest("x: {0}, y: {1}, w: {2}, h: {3}",
                         new Object[] {x, y, w, h});
             }
-            addDirtyRect(new WCRectangle(x, y, w, h));
+            WCRectangle r = new WCRectangle(x, y, w, h);
+            if (useTileRecordings) {
+                if (!tileRecordings.isEmpty()) {
+                    // The scroll position may change without fwkScroll
+                    refreshTileState();
+                }
+                invalidateTileRecordings(r);
+            }
+            addDirtyRect(r);
         } finally {
             unlockPage();
         }
@@ -2485,6 +3012,7 @@ public final class WebPage {
 
     private void fwkRepaintAll() {
         log.fine("Repainting the entire page");
+        invalidateTileRecordings();
         repaintAll();
     }
 
@@ -2621,6 +3149,8 @@ public final class WebPage {
     private native void twkSetBounds(long pPage, int x, int y, int w, int h);
     private native void twkPrePaint(long pPage);
     private native void twkUpdateContent(long pPage, WCRenderQueue rq, int x, int y, int w, int h);
+    private native void twkUpdateTile(long pPage, WCRenderQueue rq, int x, int y, int w, int h);
+    private native int[] twkGetTileState(long pPage);
     private native void twkUpdateRendering(long pPage);
     private native void twkPostPaint(long pPage, WCRenderQueue rq,
                                      int x, int y, int w, int h);
@@ -39,6 +39,11 @@ class JSObject extends netscape.javascript.JSObject {
     static final int JS_DOM_NODE_OBJECT  = 1;
     static final int JS_DOM_WINDOW_OBJECT  = 2;
 
+    // operations of batch()
+    static final int BATCH_GET_MEMBER = 0;
+    static final int BATCH_SET_MEMBER = 1;
+    static final int BATCH_CALL = 2;
+
     private final long peer;     // C++ peer - now it is the DOMObject instance
     private final int peer_type; // JS_XXXX const
 
@@ -130,6 +135,31 @@ class JSObject extends netscape.javascript.JSObject {
                                           String methodName, Object[] args,
                                           AccessControlContext acc);
 
+    // Performs several getMember, setMember and call operations on this
+    // object with a single native call. Operation i is ops[i] on the member
+    // names[i]; values[i] is the new value for BATCH_SET_MEMBER and the
+    // Object[] of arguments for BATCH_CALL. Returns the result of each
+    // operation, null for BATCH_SET_MEMBER. The batch stops at the first
+    // JavaScript exception, which is thrown as by the individual methods.
+    Object[] batch(int[] ops, String[] names, Object[] values)
+            throws JSException {
+        Invoker.getInvoker().checkEventThread();
+        if (names.length != ops.length || values.length != ops.length) {
+            throw new IllegalArgumentException("array lengths differ");
+        }
+        for (int op : ops) {
+            if (op < BATCH_GET_MEMBER || op > BATCH_CALL) {
+                throw new IllegalArgumentException("unknown operation: " + op);
+            }
+        }
+        return batchImpl(peer, peer_type, ops, names, values,
+                         AccessController.getContext());
+    }
+    private static native Object[] batchImpl(long peer, int peer_type,
+                                             int[] ops, String[] names,
+                                             Object[] values,
+                                             AccessControlContext acc);
+
     @Override
     public String toString() {
         Invoker.getInvoker().checkEventThread();
@@ -86,11 +86,21 @@ public final class GraphicsDecoder  {
     @Native public final static int SET_MITER_LIMIT        = 54;
     @Native public final static int SET_TEXT_MODE          = 55;
     @Native public final static int SET_PERSPECTIVE_TRANSFORM = 56;
+    @Native public final static int OPCODE_COUNT           = SET_PERSPECTIVE_TRANSFORM + 1;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(GraphicsDecoder.class.getName());
 
     static void decode(WCGraphicsManager gm, WCGraphicsContext gc, BufferData bdata) {
+        decode(gm, gc, bdata, 0, 0);
+    }
+
+    // Decodes the buffer with its origin translated by (tx, ty). The context
+    // is expected to be translated by the caller already; this only moves
+    // the transforms that the buffer sets absolutely.
+    static void decode(WCGraphicsManager gm, WCGraphicsContext gc, BufferData bdata,
+                       float tx, float ty)
+    {
         if (gc == null || !gc.isValid()) {
             log.fine("GraphicsDecoder::decode : GC is " +
                     (gc == null ? "null" : " invalid"));
@@ -342,7 +352,7 @@ public final class GraphicsDecoder  {
                 case SET_TRANSFORM:
                     gc.setTransform(new WCTransform(
                             buf.getFloat(), buf.getFloat(), buf.getFloat(),
-                            buf.getFloat(), buf.getFloat(), buf.getFloat()));
+                            buf.getFloat(), buf.getFloat() + tx, buf.getFloat() + ty));
                     break;
                 case COPYREGION:
                     WCPageBackBuffer buffer = (WCPageBackBuffer)gm.getRef(buf.getInt());
@@ -39,8 +39,12 @@ public abstract class WCFont extends Ref {
 
     public abstract double getGlyphWidth(int glyph);
 
+    public abstract float[] getGlyphWidths(int[] glyphs);
+
     public abstract float[] getGlyphBoundingBox(int glyph);
 
+    public abstract WCPath getGlyphPath(int glyph);
+
     /**
      * Returns a hash code value for the object.
      * NB: This method is called from native code!
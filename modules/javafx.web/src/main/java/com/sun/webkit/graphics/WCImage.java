@@ -52,7 +52,7 @@ public abstract class WCImage extends Ref {
 
     public ByteBuffer getPixelBuffer() {return null;}
 
-    protected void drawPixelBuffer() {}
+    protected void drawPixelBuffer(int x, int y, int w, int h) {}
 
     public synchronized void setRQ(WCRenderQueue rq) {
         this.rq = rq;
@@ -25,16 +25,19 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
 
 public abstract class WCImageDecoder {
 
     /**
-     * Receives a portion of image data.
+     * Receives a portion of image data. The buffer wraps native memory
+     * that is only valid during the call, so its content must be copied
+     * before the method returns.
      *
      * @param data  a portion of image data,
      *              or {@code null} if all data received
      */
-    protected abstract void addImageData(byte[] data);
+    protected abstract void addImageData(ByteBuffer data);
 
     /**
      * Returns image size.
@@ -77,6 +80,12 @@ public abstract class WCImageDecoder {
 
     protected abstract void destroy();
 
+    /**
+     * Releases the decoded frames when they can be decoded again cheaply,
+     * the encoded data is kept.
+     */
+    protected abstract void destroyDecodedFrames();
+
     protected abstract String getFilenameExtension();
 
 }
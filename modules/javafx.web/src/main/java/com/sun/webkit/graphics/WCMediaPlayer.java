@@ -27,6 +27,7 @@ package com.sun.webkit.graphics;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.Invoker;
+import java.util.concurrent.atomic.AtomicBoolean;
 
 public abstract class WCMediaPlayer extends Ref {
 
@@ -224,14 +225,23 @@ public abstract class WCMediaPlayer extends Ref {
         });
     }
 
+    // Set while a new frame notification is queued on the event thread.
+    private final AtomicBoolean newFramePending = new AtomicBoolean();
+
     private Runnable newFrameNotifier = () -> {
+        newFramePending.set(false);
         if (nPtr != 0) {
             notifyNewFrame(nPtr);
         }
     };
 
     protected void notifyNewFrame() {
-        Invoker.getInvoker().invokeOnEventThread(newFrameNotifier);
+        // Frames may arrive faster than the event thread handles them. The
+        // render always draws the latest frame, so one queued notification
+        // covers all the frames that arrive before it runs.
+        if (newFramePending.compareAndSet(false, true)) {
+            Invoker.getInvoker().invokeOnEventThread(newFrameNotifier);
+        }
     }
 
     /** {@code ranges} array contains pairs [start,end] of the buffered times */
@@ -82,6 +82,14 @@ public abstract class WCPath<P> extends Ref {
 
     public abstract void closeSubpath();
 
+    /**
+     * Appends a batch of segments. {@code types} holds one of the
+     * {@code WCPathIterator.SEG_*} constants per segment and {@code coords}
+     * holds the x, y pairs of all segment points in order.
+     * NB: This method is called from native code!
+     */
+    public abstract void addSegments(int[] types, float[] coords);
+
     public abstract boolean isEmpty();
 
     public abstract void translate(double x, double y);
@@ -30,12 +30,15 @@ import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.webkit.Invoker;
 import java.nio.ByteBuffer;
+import java.util.Arrays;
 import java.util.HashMap;
 import java.util.LinkedList;
 import java.util.concurrent.atomic.AtomicInteger;
 
 public abstract class WCRenderQueue extends Ref {
     private final static AtomicInteger idCountObj = new AtomicInteger(0);
+    // Native command buffers handed to Java and not yet released by twkRelease
+    private final static AtomicInteger buffersInFlight = new AtomicInteger(0);
     private final static PlatformLogger log =
             PlatformLogger.getLogger(WCRenderQueue.class.getName());
     @Native public final static int MAX_QUEUE_SIZE = 0x80000;
@@ -65,12 +68,32 @@ public abstract class WCRenderQueue extends Ref {
         return size;
     }
 
-    public synchronized void addBuffer(ByteBuffer buffer) {
+    public static int getBuffersInFlight() {
+        return buffersInFlight.get();
+    }
+
+    /**
+     * Fills the arrays, indexed by {@link GraphicsDecoder} opcode, with the
+     * number of state commands encoded and elided by the native graphics
+     * contexts since the previous call, and resets the native counters.
+     * Returns the number of bytes saved by the elided commands.
+     * Must be called on the Event thread.
+     */
+    public static int getStateCounters(int[] encoded, int[] elided) {
+        return twkGetStateCounters(encoded, elided);
+    }
+
+    public void addBuffer(ByteBuffer buffer) {
+        addBuffer(buffer, BufferData.NO_NATIVE_ID);
+    }
+
+    private synchronized void addBuffer(ByteBuffer buffer, int nativeId) {
         if (log.isLoggable(Level.FINE) && buffers.isEmpty()) {
             log.fine("'{'WCRenderQueue{0}[{1}]",
                     new Object[]{hashCode(), idCountObj.incrementAndGet()});
         }
         currentBuffer.setBuffer(buffer);
+        currentBuffer.setNativeId(nativeId);
         buffers.addLast(currentBuffer);
         currentBuffer = new BufferData();
         size += buffer.capacity();
@@ -103,6 +126,29 @@ public abstract class WCRenderQueue extends Ref {
         dispose();
     }
 
+    /**
+     * Decodes the queue into the given context like {@link #decode(WCGraphicsContext)}
+     * does, but keeps the buffers so that the queue can be decoded again.
+     * The queue is decoded with its origin at ({@code x}, {@code y}), which
+     * also applies to the transforms it sets absolutely.
+     */
+    public synchronized void replay(WCGraphicsContext gc, float x, float y) {
+        if (gc == null || !gc.isValid()) {
+            log.fine("WCRenderQueue::replay : GC is " + (gc == null ? "null" : " invalid"));
+            return;
+        }
+
+        for (BufferData bdata : buffers) {
+            bdata.getBuffer().rewind();
+            try {
+                GraphicsDecoder.decode(
+                    WCGraphicsManager.getGraphicsManager(), gc, bdata, x, y);
+            } catch (RuntimeException e) {
+                e.printStackTrace(System.err);
+            }
+        }
+    }
+
     public synchronized void decode() {
         if (gc == null || !gc.isValid()) {
             log.fine("WCRenderQueue::decode : GC is " + (gc == null ? "null" : " invalid"));
@@ -127,8 +173,9 @@ public abstract class WCRenderQueue extends Ref {
         flush();
     }
 
-    private void fwkAddBuffer(ByteBuffer buffer) {
-        addBuffer(buffer);
+    private void fwkAddBuffer(ByteBuffer buffer, int nativeId) {
+        buffersInFlight.incrementAndGet();
+        addBuffer(buffer, nativeId);
     }
 
     public WCRectangle getClip() {
@@ -139,14 +186,20 @@ public abstract class WCRenderQueue extends Ref {
         int n = buffers.size();
         if (n > 0) {
             int i = 0;
-            final Object[] arr = new Object[n];
+            final int[] ids = new int[n];
             for (BufferData bdata: buffers) {
-                arr[i++] = bdata.getBuffer();
+                if (bdata.getNativeId() != BufferData.NO_NATIVE_ID) {
+                    ids[i++] = bdata.getNativeId();
+                }
             }
             buffers.clear();
-            Invoker.getInvoker().invokeOnEventThread(() -> {
-                twkRelease(arr);
-            });
+            if (i > 0) {
+                final int[] arr = (i < n) ? Arrays.copyOf(ids, i) : ids;
+                Invoker.getInvoker().invokeOnEventThread(() -> {
+                    twkRelease(arr);
+                    buffersInFlight.addAndGet(-arr.length);
+                });
+            }
             size = 0;
             if (log.isLoggable(Level.FINE)) {
                 log.fine("'}'WCRenderQueue{0}[{1}]",
@@ -161,7 +214,9 @@ public abstract class WCRenderQueue extends Ref {
         disposeGraphics();
     }
 
-    private native void twkRelease(Object[] bufs);
+    private native void twkRelease(int[] ids);
+
+    private static native int twkGetStateCounters(int[] encoded, int[] elided);
 
     /*is called from native*/
     private int refString(String str) {
@@ -192,6 +247,8 @@ public abstract class WCRenderQueue extends Ref {
 }
 
 final class BufferData {
+    static final int NO_NATIVE_ID = -1;
+
     /* For passing data that does not fit into the queue */
     private final AtomicInteger idCount = new AtomicInteger(0);
     private final HashMap<Integer,String> strMap =
@@ -202,6 +259,7 @@ final class BufferData {
             new HashMap<Integer,float[]>();
 
     private ByteBuffer buffer;
+    private int nativeId = NO_NATIVE_ID;
 
     private int createID() {
         return idCount.incrementAndGet();
@@ -244,4 +302,12 @@ final class BufferData {
     void setBuffer(ByteBuffer buffer) {
         this.buffer = buffer;
     }
+
+    int getNativeId() {
+        return nativeId;
+    }
+
+    void setNativeId(int nativeId) {
+        this.nativeId = nativeId;
+    }
 }
@@ -26,11 +26,28 @@
 package com.sun.webkit.graphics;
 
 public interface WCTextRun {
-    boolean isLeftToRight();
-    float[] getGlyphPosAndAdvance(int glyphIndex);
-    int getCharOffset(int index);
-    int getEnd();
-    int getGlyph(int index);
-    int getGlyphCount();
-    int getStart();
+    int FLAGS = 0;
+    int START = 1;
+    int END = 2;
+    int GLYPH_COUNT = 3;
+    int INITIAL_ADVANCE_X = 4;
+    int INITIAL_ADVANCE_Y = 5;
+    int HEADER_SIZE = 6;
+
+    int GLYPH_CODE = 0;
+    int GLYPH_CHAR_OFFSET = 1;
+    int GLYPH_ADVANCE = 2;
+    int GLYPH_SIZE = 3;
+
+    int FLAG_LEFT_TO_RIGHT = 1;
+
+    /**
+     * Returns the shaped run packed into a single array so that native code
+     * can fetch it with one call. The array starts with {@code HEADER_SIZE}
+     * values indexed by {@code FLAGS} ... {@code INITIAL_ADVANCE_Y},
+     * followed by {@code GLYPH_SIZE} values per glyph. Float values
+     * (initial advance, glyph advances) are stored as raw int bits.
+     * NB: This method is called from native code!
+     */
+    int[] getGlyphData();
 }
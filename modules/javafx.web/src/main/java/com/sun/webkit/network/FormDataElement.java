@@ -29,6 +29,7 @@ import java.io.BufferedInputStream;
 import java.io.ByteArrayInputStream;
 import java.io.File;
 import java.io.FileInputStream;
+import java.io.FilterInputStream;
 import java.io.IOException;
 import java.io.InputStream;
 
@@ -106,10 +107,14 @@ abstract class FormDataElement {
     }
 
     /**
-     * Creates a new FormDataElement from a file.
+     * Creates a new FormDataElement from a range of a file.
+     * A negative length denotes the range extending to the end of the file.
      */
-    private static FormDataElement fwkCreateFromFile(String fileName) {
-        return new FileElement(fileName);
+    private static FormDataElement fwkCreateFromFile(String fileName,
+                                                     long offset,
+                                                     long length)
+    {
+        return new FileElement(fileName, offset, length);
     }
 
     /**
@@ -137,26 +142,96 @@ abstract class FormDataElement {
     }
 
     /**
-     * A form data element based on a file.
+     * A form data element based on a range of a file. The content
+     * is streamed from the file rather than read into memory.
      */
     private static final class FileElement extends FormDataElement {
 
         private final File file;
+        private final long offset;
+        private final long length;
 
 
-        private FileElement(String filename) {
+        private FileElement(String filename, long offset, long length) {
             file = new File(filename);
+            this.offset = Math.max(offset, 0);
+            this.length = length;
         }
 
 
         @Override
         protected InputStream createInputStream() throws IOException {
-            return new BufferedInputStream(new FileInputStream(file));
+            FileInputStream fileInputStream = new FileInputStream(file);
+            if (offset > 0) {
+                fileInputStream.getChannel().position(offset);
+            }
+            InputStream inputStream = new BufferedInputStream(fileInputStream);
+            return length < 0
+                    ? inputStream
+                    : new RangeInputStream(inputStream, doGetSize());
         }
 
         @Override
         protected long doGetSize() {
-            return file.length();
+            long available = Math.max(file.length() - offset, 0);
+            return length < 0 ? available : Math.min(length, available);
+        }
+    }
+
+    /**
+     * An input stream returning at most a given number of bytes
+     * of the underlying stream.
+     */
+    private static final class RangeInputStream extends FilterInputStream {
+
+        private long remaining;
+
+
+        private RangeInputStream(InputStream in, long remaining) {
+            super(in);
+            this.remaining = remaining;
+        }
+
+
+        @Override
+        public int read() throws IOException {
+            if (remaining <= 0) {
+                return -1;
+            }
+            int result = in.read();
+            if (result != -1) {
+                remaining--;
+            }
+            return result;
+        }
+
+        @Override
+        public int read(byte[] b, int off, int len) throws IOException {
+            if (remaining <= 0) {
+                return -1;
+            }
+            int result = in.read(b, off, (int) Math.min(len, remaining));
+            if (result > 0) {
+                remaining -= result;
+            }
+            return result;
+        }
+
+        @Override
+        public long skip(long n) throws IOException {
+            long result = in.skip(Math.min(n, remaining));
+            remaining -= result;
+            return result;
+        }
+
+        @Override
+        public int available() throws IOException {
+            return (int) Math.min(in.available(), remaining);
+        }
+
+        @Override
+        public boolean markSupported() {
+            return false;
         }
     }
 }
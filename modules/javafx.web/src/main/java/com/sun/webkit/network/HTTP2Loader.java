@@ -529,6 +529,11 @@ final class HTTP2Loader extends URLLoaderBase {
     }
 
     private ByteBuffer copyToDirectBuffer(final ByteBuffer bb) {
+        // Direct buffers are handed to the native side as they are,
+        // only heap buffers need to be staged.
+        if (bb.isDirect()) {
+            return bb;
+        }
         return getDirectBuffer(bb.limit()).put(bb).flip();
     }
 
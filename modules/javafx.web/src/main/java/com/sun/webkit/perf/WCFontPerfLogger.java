@@ -27,6 +27,7 @@ package com.sun.webkit.perf;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.graphics.WCFont;
+import com.sun.webkit.graphics.WCPath;
 import com.sun.webkit.graphics.WCTextRun;
 
 public final class WCFontPerfLogger extends WCFont {
@@ -92,6 +93,13 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
+    public float[] getGlyphWidths(int[] glyphs) {
+        logger.resumeCount("GETGLYPHWIDTHS");
+        float[] res = fnt.getGlyphWidths(glyphs);
+        logger.suspendCount("GETGLYPHWIDTHS");
+        return res;
+    }
+
     public float[] getGlyphBoundingBox(int glyph) {
         logger.resumeCount("GETGLYPHBOUNDINGBOX");
         float[] res = fnt.getGlyphBoundingBox(glyph);
@@ -99,6 +107,13 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
+    public WCPath getGlyphPath(int glyph) {
+        logger.resumeCount("GETGLYPHPATH");
+        WCPath res = fnt.getGlyphPath(glyph);
+        logger.suspendCount("GETGLYPHPATH");
+        return res;
+    }
+
     public int hashCode() {
         logger.resumeCount("HASH");
         int res = fnt.hashCode();
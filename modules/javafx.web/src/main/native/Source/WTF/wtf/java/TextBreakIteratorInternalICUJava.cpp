@@ -27,30 +27,68 @@
 
 #include "TextBreakIteratorInternalICU.h"
 
+#include <mutex>
+#include <unicode/uloc.h>
 #include <wtf/StdLibExtras.h>
+#include <wtf/java/JavaEnv.h>
+#include <wtf/java/JavaRef.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/text/CString.h>
 
 
 namespace WTF {
 
-static const char* UILanguage()
+// Converts the default java.util.Locale to an ICU locale ID, so that text
+// is broken the same way as by java.text.BreakIterator. Looked up once, the
+// ICU iterators ask for the locale every time they are opened.
+static const char* javaDefaultLocaleID()
 {
-    // Chrome's UI language can be different from the OS UI language on Windows.
-    // We want to return Chrome's UI language here.
-    // DEPRECATED_DEFINE_STATIC_LOCAL(CString, locale, (WebCore::defaultLanguage().latin1()));
-    // FIXME-java: Get default language from Java using Locale.getDefault()
-    return "en";
+    static char localeID[ULOC_FULLNAME_CAPACITY] = "en";
+    static std::once_flag initializeLocaleOnce;
+    std::call_once(initializeLocaleOnce, [] {
+        JNIEnv* env = GetJavaEnv();
+        if (!env) {
+            return;
+        }
+
+        JLClass localeClass(env->FindClass("java/util/Locale"));
+        if (CheckAndClearException(env) || !localeClass) {
+            return;
+        }
+        jmethodID midGetDefault = env->GetStaticMethodID(
+            localeClass, "getDefault", "()Ljava/util/Locale;");
+        jmethodID midToLanguageTag = env->GetMethodID(
+            localeClass, "toLanguageTag", "()Ljava/lang/String;");
+        ASSERT(midGetDefault && midToLanguageTag);
+
+        JLObject locale(env->CallStaticObjectMethod(localeClass, midGetDefault));
+        if (CheckAndClearException(env) || !locale) {
+            return;
+        }
+        JLString tag((jstring)env->CallObjectMethod(locale, midToLanguageTag));
+        if (CheckAndClearException(env) || !tag) {
+            return;
+        }
+
+        CString languageTag = String(env, tag).utf8();
+        char buffer[ULOC_FULLNAME_CAPACITY];
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t length = uloc_forLanguageTag(languageTag.data(), buffer, sizeof(buffer), nullptr, &status);
+        if (U_SUCCESS(status) && status != U_STRING_NOT_TERMINATED_WARNING && length > 0) {
+            memcpy(localeID, buffer, length + 1);
+        }
+    });
+    return localeID;
 }
 
 const char* currentSearchLocaleID()
 {
-    return UILanguage();
+    return javaDefaultLocaleID();
 }
 
 const char* currentTextBreakLocaleID()
 {
-    return UILanguage();
+    return javaDefaultLocaleID();
 }
 
-} // namespace WebCore
+} // namespace WTF
@@ -542,6 +542,41 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
         , long event);
 
 
+// Subtree serialization
+    static final int SERIALIZE_GEOMETRY = 1;
+
+    /**
+     * Serializes the subtree rooted at this node in a single native call,
+     * instead of one call per node, attribute and child access.
+     * <p>
+     * The buffer is big endian. A string is an {@code int} count of UTF-16
+     * code units followed by the units. The buffer starts with the
+     * {@code int} number of records, followed by the records in document
+     * order:
+     * <pre>
+     * short  nodeType   ELEMENT_NODE, TEXT_NODE or CDATA_SECTION_NODE
+     * int    parent     index of the nearest enclosing record, or -1
+     * element:
+     *   string tagName
+     *   int    attributeCount, then attributeCount pairs of string name, string value
+     *   float  x, y, width, height of the bounding client rect, only with SERIALIZE_GEOMETRY
+     * text or CDATA section:
+     *   string data
+     * </pre>
+     * If {@code selectors} is not null, only the elements matching it are
+     * written, together with their text children.
+     */
+    byte[] serializeSubtree(String selectors, int flags) throws DOMException
+    {
+        return serializeSubtreeImpl(getPeer()
+            , selectors
+            , flags);
+    }
+    native static byte[] serializeSubtreeImpl(long peer
+        , String selectors
+        , int flags);
+
+
 
 //stubs
     public Object getUserData(String key) {
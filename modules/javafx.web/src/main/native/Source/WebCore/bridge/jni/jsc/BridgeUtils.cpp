@@ -46,6 +46,7 @@
 #include "runtime_root.h"
 #include <wtf/java/JavaRef.h>
 #include <wtf/text/WTFString.h>
+#include <JavaScriptCore/ArgList.h>
 #include <JavaScriptCore/JSArray.h>
 #include <JavaScriptCore/JSLock.h>
 #include <JavaScriptCore/APICast.h>
@@ -190,9 +191,12 @@ JSValueRef Java_Object_to_JSValue(
         return JSValueMakeNumber(ctx, value);
     }
 
-    JLObject valClass(JSC::Bindings::callJNIMethod<jobject>(val, "getClass", "()Ljava/lang/Class;"));
-    if (JSC::Bindings::callJNIMethod<jboolean>(valClass, "isArray", "()Z")) {
-        JLString className((jstring)JSC::Bindings::callJNIMethod<jobject>(valClass, "getName", "()Ljava/lang/String;"));
+    JLClass valClass(env->GetObjectClass(val));
+    static JGClass clClass(env->FindClass("java/lang/Class"));
+    static jmethodID isArrayMethod = env->GetMethodID(clClass, "isArray", "()Z");
+    if (env->CallBooleanMethod(valClass, isArrayMethod)) {
+        static jmethodID getNameMethod = env->GetMethodID(clClass, "getName", "()Ljava/lang/String;");
+        JLString className((jstring) env->CallObjectMethod(valClass, getNameMethod));
         const char* classNameC = JSC::Bindings::getCharactersFromJString(className);
         JSC::JSValue arr = JSC::Bindings::JavaArray::convertJObjectToArray(lexicalGlobalObject, val, classNameC, rootObject, accessControlContext);
         JSC::Bindings::releaseCharactersForJString(className, classNameC);
@@ -275,7 +279,7 @@ RefPtr<JSC::Bindings::RootObject> checkJSPeer(
     JSObjectRef &object,
     JSContextRef &context)
 {
-    JSC::Bindings::RootObject *rootObject = nullptr;
+    RefPtr<JSC::Bindings::RootObject> rootObject;
     switch (peer_type) {
     case com_sun_webkit_dom_JSObject_JS_CONTEXT_OBJECT:
         {
@@ -296,7 +300,9 @@ RefPtr<JSC::Bindings::RootObject> checkJSPeer(
             if (!frame) {
                 return rootObject;
             }
-            rootObject = &(frame->script().createRootObject(frame).leakRef());
+            // The script controller keeps the root object of a frame alive,
+            // so only a plain reference is taken here.
+            rootObject = frame->script().createRootObject(frame);
             if (rootObject) {
                 context = WebCore::getGlobalContext(&frame->script());
                 JSC::JSGlobalObject* JSGlobalObject = toJS(context);
@@ -447,6 +453,45 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_JSObject_toStringImpl
         .toJavaString(env).releaseLocal();
 }
 
+// Calls the method methodName of the object with the given Java arguments
+// and returns the result as a Java object. A JavaScript exception is thrown
+// as a JSException and nullptr is returned.
+static jobject callMethod(JNIEnv* env, JSContextRef ctx, JSObjectRef object,
+    JSC::Bindings::RootObject* rootObject, jstring methodName, jobjectArray args,
+    jobject accessControlContext)
+{
+    JSStringRef name = WebCore::asJSStringRef(env, methodName);
+    JSValueRef member = JSObjectGetProperty(ctx, object, name, nullptr);
+    JSStringRelease(name);
+    if (!JSValueIsObject(ctx, member))
+        return JSC::Bindings::convertUndefinedToJObject();
+    JSObjectRef function = JSValueToObject(ctx, member, nullptr);
+    if (! JSObjectIsFunction(ctx, function))
+        return JSC::Bindings::convertUndefinedToJObject();
+    size_t argumentCount = args ? env->GetArrayLength(args) : 0;
+    JSC::JSGlobalObject* globalObject = toJS(ctx);
+    JSC::JSLockHolder lock(globalObject);
+    // The converted arguments are kept in a MarkedArgumentBuffer, so that
+    // values created for earlier arguments stay reachable while the later
+    // ones are converted.
+    JSC::MarkedArgumentBuffer protectedArguments;
+    Vector<JSValueRef, 8> arguments(argumentCount);
+    for (size_t i = 0;  i < argumentCount; i++) {
+        JLObject jarg(env->GetObjectArrayElement(args, i));
+        arguments[i] = WebCore::Java_Object_to_JSValue(env, ctx, rootObject, jarg, accessControlContext);
+        protectedArguments.append(toJS(globalObject, arguments[i]));
+    }
+    JSValueRef exception = 0;
+    JSValueRef result = JSObjectCallAsFunction(ctx, function, object,
+                                               argumentCount, arguments.data(),
+                                               &exception);
+    if (exception) {
+        WebCore::throwJavaException(env, ctx, exception, rootObject);
+        return nullptr;
+    }
+    return WebCore::JSValue_to_Java_Object(result, env, ctx, rootObject);
+}
+
 JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_callImpl
   (JNIEnv *env, jclass, jlong peer, jint peer_type, jstring methodName, jobjectArray args, jobject accessControlContext)
 {
@@ -461,31 +506,81 @@ JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_callImpl
         env->ThrowNew(getJSExceptionClass(env), "Invalid function reference");
         return nullptr;
     }
+    return callMethod(env, ctx, object, rootObject.get(), methodName, args, accessControlContext);
+}
 
-    JSStringRef name = WebCore::asJSStringRef(env, methodName);
-    JSValueRef member = JSObjectGetProperty(ctx, object, name, nullptr);
-    JSStringRelease(name);
-    if (!JSValueIsObject(ctx, member))
-        return JSC::Bindings::convertUndefinedToJObject();
-    JSObjectRef function = JSValueToObject(ctx, member, nullptr);
-    if (! JSObjectIsFunction(ctx, function))
-        return JSC::Bindings::convertUndefinedToJObject();
-    size_t argumentCount = env->GetArrayLength(args);
-    JSValueRef *arguments = new JSValueRef[argumentCount];
-    for (size_t i = 0;  i < argumentCount; i++) {
-      JLObject jarg(env->GetObjectArrayElement(args, i));
-        arguments[i] = WebCore::Java_Object_to_JSValue(env, ctx, rootObject.get(), jarg, accessControlContext);
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_dom_JSObject_batchImpl
+(JNIEnv *env, jclass, jlong peer, jint peer_type, jintArray ops, jobjectArray names, jobjectArray values, jobject accessControlContext)
+{
+    if (ops == nullptr || names == nullptr || values == nullptr) {
+        throwNullPointerException(env);
+        return nullptr;
     }
-    JSValueRef exception = 0;
-    JSValueRef result = JSObjectCallAsFunction(ctx, function, object,
-                                               argumentCount,  arguments,
-                                               &exception);
-    delete[] arguments;
-    if (exception) {
-        WebCore::throwJavaException(env, ctx, exception, rootObject.get());
+    JSObjectRef object;
+    JSContextRef ctx;
+    RefPtr<JSC::Bindings::RootObject> rootObject(checkJSPeer(peer, peer_type, object, ctx));
+    if (rootObject.get() == nullptr || !ctx) {
+        throwNullPointerException(env);
         return nullptr;
     }
-    return WebCore::JSValue_to_Java_Object(result, env, ctx, rootObject.get());
+
+    jsize count = env->GetArrayLength(ops);
+    Vector<jint> opcodes(count);
+    env->GetIntArrayRegion(ops, 0, count, opcodes.data());
+    static JGClass objectClass(env->FindClass("java/lang/Object"));
+    JLObjectArray results(env->NewObjectArray(count, objectClass, nullptr));
+    if (!results)
+        return nullptr;
+
+    // The peer is resolved and the lock is taken once for the whole batch;
+    // each operation then behaves like the matching getMember, setMember
+    // or call, and the batch stops at the first exception.
+    JSC::JSLockHolder lock(toJS(ctx));
+    for (jsize i = 0; i < count; i++) {
+        JLString str((jstring) env->GetObjectArrayElement(names, i));
+        if (!str) {
+            throwNullPointerException(env);
+            return nullptr;
+        }
+        jobject result = nullptr;
+        switch (opcodes[i]) {
+        case com_sun_webkit_dom_JSObject_BATCH_GET_MEMBER: {
+            JSStringRef name = WebCore::asJSStringRef(env, str);
+            JSValueRef value = JSObjectGetProperty(ctx, object, name, nullptr);
+            JSStringRelease(name);
+            result = WebCore::JSValue_to_Java_Object(value, env, ctx, rootObject.get());
+            break;
+        }
+        case com_sun_webkit_dom_JSObject_BATCH_SET_MEMBER: {
+            JLObject value(env->GetObjectArrayElement(values, i));
+            JSStringRef name = WebCore::asJSStringRef(env, str);
+            JSValueRef jsvalue = WebCore::Java_Object_to_JSValue(env, ctx, rootObject.get(), value, accessControlContext);
+            JSValueRef exception = 0;
+            JSObjectSetProperty(ctx, object, name, jsvalue, 0, &exception);
+            JSStringRelease(name);
+            if (exception) {
+                WebCore::throwJavaException(env, ctx, exception, rootObject.get());
+                return nullptr;
+            }
+            break;
+        }
+        case com_sun_webkit_dom_JSObject_BATCH_CALL: {
+            JLObjectArray args((jobjectArray) env->GetObjectArrayElement(values, i));
+            result = callMethod(env, ctx, object, rootObject.get(), str, args, accessControlContext);
+            break;
+        }
+        default:
+            ASSERT_NOT_REACHED();
+            break;
+        }
+        if (env->ExceptionCheck())
+            return nullptr;
+        env->SetObjectArrayElement(results, i, result);
+        // undefined is converted to a shared global reference
+        if (result && env->GetObjectRefType(result) == JNILocalRefType)
+            env->DeleteLocalRef(result);
+    }
+    return results.releaseLocal();
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_unprotectImpl
@@ -35,6 +35,7 @@
 #include "runtime_root.h"
 #include <JavaScriptCore/JSArray.h>
 #include <JavaScriptCore/JSLock.h>
+#include <wtf/java/JavaEnv.h>
 
 #include "JavaArrayJSC.h"
 #include "JavaInstanceJSC.h"
@@ -156,7 +157,7 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                 } else if (value.isString() && !strcmp(javaClassName, "java.lang.Character")) {
                     JNIEnv* env = getJNIEnv();
                     static JGClass clazz(env->FindClass("java/lang/Character"));
-                    jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(C)Ljava/lang/Character;");
+                    static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(C)Ljava/lang/Character;");
                     jchar charValue = toJCharValue(value, globalObject);
                     jobject javaChar = env->CallStaticObjectMethod(clazz, meth, charValue);
                     result.l = javaChar;
@@ -164,12 +165,12 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                     JNIEnv* env = getJNIEnv();
                     if (value.isInt32() && (!strcmp(javaClassName, "java.lang.Number") || !strcmp(javaClassName, "java.lang.Integer") || !strcmp(javaClassName, "java.lang.Object"))) {
                         static JGClass clazz(env->FindClass("java/lang/Integer"));
-                        jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(I)Ljava/lang/Integer;");
+                        static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(I)Ljava/lang/Integer;");
                         result.l = env->CallStaticObjectMethod(clazz, meth, (jint) value.asInt32());
                     } else if (!strcmp(javaClassName, "java.lang.Number") || !strcmp(javaClassName, "java.lang.Double") || !strcmp(javaClassName, "java.lang.Object")) {
                         jdouble doubleValue = (jdouble) value.asNumber();
                         static JGClass clazz = env->FindClass("java/lang/Double");
-                        jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(D)Ljava/lang/Double;");
+                        static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(D)Ljava/lang/Double;");
                         jobject javaDouble = env->CallStaticObjectMethod(clazz, meth, doubleValue);
                         result.l = javaDouble;
                     }
@@ -177,7 +178,7 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                     bool boolValue = value.asBoolean();
                     JNIEnv* env = getJNIEnv();
                     static JGClass clazz(env->FindClass("java/lang/Boolean"));
-                    jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(Z)Ljava/lang/Boolean;");
+                    static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(Z)Ljava/lang/Boolean;");
                     jobject javaBoolean = env->CallStaticObjectMethod(clazz, meth, boolValue);
                     result.l = javaBoolean;
                 } else if (value.isUndefined()) {
@@ -255,50 +256,49 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
 
 jobject jvalueToJObject(jvalue value, JavaType jtype) {
     JNIEnv* env = getJNIEnv();
-    jmethodID meth;
     switch (jtype) {
     case JavaTypeObject:
     case JavaTypeArray:
         return value.l;
     case JavaTypeBoolean: {
       static JGClass clsZ(env->FindClass("java/lang/Boolean"));
-      meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
+      static jmethodID meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
       return env->CallStaticObjectMethod(clsZ, meth, value.z);
     }
     case JavaTypeChar: {
       static JGClass clsC(env->FindClass("java/lang/Character"));
-      meth = env->GetStaticMethodID(clsC, "valueOf",
-                                    "(C)Ljava/lang/Character;");
+      static jmethodID meth = env->GetStaticMethodID(clsC, "valueOf",
+                                                     "(C)Ljava/lang/Character;");
       return env->CallStaticObjectMethod(clsC, meth, value.c);
     }
     case JavaTypeByte: {
       static JGClass clsB(env->FindClass("java/lang/Byte"));
-      meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
+      static jmethodID meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
       return env->CallStaticObjectMethod(clsB, meth, value.b);
     }
     case JavaTypeShort: {
       static JGClass clsS(env->FindClass("java/lang/Short"));
-      meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
+      static jmethodID meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
       return env->CallStaticObjectMethod(clsS, meth, value.s);
     }
     case JavaTypeInt: {
       static JGClass clsI(env->FindClass("java/lang/Integer"));
-      meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
+      static jmethodID meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
       return env->CallStaticObjectMethod(clsI, meth, value.i);
     }
     case JavaTypeLong: {
       static JGClass clsJ(env->FindClass("java/lang/Long"));
-      meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
+      static jmethodID meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
       return env->CallStaticObjectMethod(clsJ, meth, value.j);
     }
     case JavaTypeFloat: {
       static JGClass clsF(env->FindClass("java/lang/Float"));
-      meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
+      static jmethodID meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
       return env->CallStaticObjectMethod(clsF, meth, value.f);
     }
     case JavaTypeDouble: {
       static JGClass clsD(env->FindClass("java/lang/Double"));
-      meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
+      static jmethodID meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
       return env->CallStaticObjectMethod(clsD, meth, value.d);
     }
     default:
@@ -306,7 +306,63 @@ jobject jvalueToJObject(jvalue value, JavaType jtype) {
     }
 }
 
-jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
+// Unboxes the value returned by Utilities.fwkInvokeWithContext, using
+// method IDs resolved once rather than per call.
+static void unboxJObject(JNIEnv* env, jobject r, JavaType returnType, jvalue& result)
+{
+    static JGClass clsZ(env->FindClass("java/lang/Boolean"));
+    static JGClass clsN(env->FindClass("java/lang/Number"));
+    static jmethodID booleanValue = env->GetMethodID(clsZ, "booleanValue", "()Z");
+    static jmethodID byteValue = env->GetMethodID(clsN, "byteValue", "()B");
+    static jmethodID shortValue = env->GetMethodID(clsN, "shortValue", "()S");
+    static jmethodID intValue = env->GetMethodID(clsN, "intValue", "()I");
+    static jmethodID longValue = env->GetMethodID(clsN, "longValue", "()J");
+    static jmethodID floatValue = env->GetMethodID(clsN, "floatValue", "()F");
+    static jmethodID doubleValue = env->GetMethodID(clsN, "doubleValue", "()D");
+
+    if (!r) {
+        result.j = 0;
+        return;
+    }
+
+    switch (returnType) {
+    case JavaTypeBoolean:
+        result.z = env->CallBooleanMethod(r, booleanValue);
+        break;
+
+    case JavaTypeByte:
+        result.b = env->CallByteMethod(r, byteValue);
+        break;
+
+    case JavaTypeShort:
+        result.s = env->CallShortMethod(r, shortValue);
+        break;
+
+    case JavaTypeInt:
+        result.i = env->CallIntMethod(r, intValue);
+        break;
+
+    case JavaTypeLong:
+        result.j = env->CallLongMethod(r, longValue);
+        break;
+
+    case JavaTypeFloat:
+        result.f = env->CallFloatMethod(r, floatValue);
+        break;
+
+    case JavaTypeDouble:
+        result.d = env->CallDoubleMethod(r, doubleValue);
+        break;
+
+    default:
+        ASSERT_NOT_REACHED();
+        break;
+    }
+    WTF::CheckAndClearException(env);
+    env->DeleteLocalRef(r);
+}
+
+jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext, jobject reflectedMethod) {
 
     // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
     JLObject jlinstance(obj, true);
@@ -317,18 +373,24 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     }
 
     JNIEnv* env = getJNIEnv();
-    jclass objClass = env->GetObjectClass(obj);
-    jobject rmethod = env->ToReflectedMethod(objClass, methodId, isStatic);
-    jclass utilityCls = env->FindClass("com/sun/webkit/Utilities");
-    jclass objectCls = env->FindClass("java/lang/Object");
-    jobjectArray argsArray = env->NewObjectArray(count, objectCls, NULL);
-    for (int i = 0;  i < count; i++)
-      env->SetObjectArrayElement(argsArray, i, args[i]);
-    jmethodID invokeMethod =
+    static JGClass utilityCls(env->FindClass("com/sun/webkit/Utilities"));
+    static JGClass objectCls(env->FindClass("java/lang/Object"));
+    static jmethodID invokeMethod =
         env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
                                "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/security/AccessControlContext;)Ljava/lang/Object;");
+
+    // The call still goes through fwkInvokeWithContext, which enforces the
+    // allow and reject lists guarding the bridge, so only the lookups are
+    // cached. Callers holding the reflected method pass it in directly.
+    JLClass objClass(reflectedMethod ? nullptr : env->GetObjectClass(obj));
+    JLObject rmethod(reflectedMethod ? nullptr : env->ToReflectedMethod(objClass, methodId, isStatic));
+    if (!reflectedMethod)
+        reflectedMethod = rmethod;
+    JLObjectArray argsArray(count ? env->NewObjectArray(count, objectCls, NULL) : nullptr);
+    for (int i = 0;  i < count; i++)
+      env->SetObjectArrayElement(argsArray, i, args[i]);
     jobject r = env->CallStaticObjectMethod(utilityCls, invokeMethod,
-                                            rmethod, obj, argsArray,
+                                            reflectedMethod, obj, (jobjectArray) argsArray,
                                             accessControlContext);
 
     jthrowable ex = env->ExceptionOccurred();
@@ -336,8 +398,8 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
 
     switch (returnType) {
     case JavaTypeVoid:
-        {
-        }
+        if (r)
+            env->DeleteLocalRef(r);
         break;
     case JavaTypeArray:
     case JavaTypeObject:
@@ -348,31 +410,13 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
         break;
 
     case JavaTypeBoolean:
-        result.z = callJNIMethod<jboolean>(r, "booleanValue", "()Z");
-        break;
-
     case JavaTypeByte:
-        result.b = callJNIMethod<jbyte>(r, "byteValue", "()B");
-        break;
-
     case JavaTypeShort:
-        result.s = callJNIMethod<jshort>(r, "shortValue", "()S");
-        break;
-
     case JavaTypeInt:
-        result.i = callJNIMethod<jint>(r, "intValue", "()I");
-        break;
-
     case JavaTypeLong:
-        result.j = callJNIMethod<jlong>(r, "longValue", "()J");
-        break;
-
     case JavaTypeFloat:
-        result.f = callJNIMethod<jfloat>(r, "floatValue", "()F");
-        break;
-
     case JavaTypeDouble:
-        result.d = callJNIMethod<jdouble>(r, "doubleValue", "()D");
+        unboxJObject(env, r, returnType, result);
         break;
 
     case JavaTypeInvalid:
@@ -36,6 +36,8 @@
 #include "runtime_object.h"
 #include "runtime_root.h"
 #include <JavaScriptCore/Error.h>
+#include <JavaScriptCore/JSTypedArrays.h>
+#include <wtf/java/JavaEnv.h>
 
 #include "Logging.h"
 
@@ -276,4 +278,111 @@ unsigned int JavaArray::getLength() const
     return m_length;
 }
 
+// Reading elements one by one costs a JNI call per element. A script that
+// wants the whole array calls toTypedArray() instead, which copies it with
+// a single call into a new typed array. The copy does not follow later
+// changes of the Java array, in either direction.
+JSValue JavaArray::toTypedArray(JSGlobalObject* globalObject) const
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    // Since javaArray() is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(javaArray(), true);
+
+    if (!jlinstance) {
+        LOG_ERROR("Could not get javaInstance for %p in JavaArray::toTypedArray", (jobject)jlinstance);
+        return jsUndefined();
+    }
+
+    JNIEnv* env = getJNIEnv();
+    JSObject* result = nullptr;
+    switch (javaTypeFromPrimitiveType(m_type[1])) {
+    case JavaTypeBoolean:
+        {
+            auto* view = JSUint8Array::create(globalObject, globalObject->typedArrayStructure(TypeUint8), m_length);
+            RETURN_IF_EXCEPTION(scope, { });
+            env->GetBooleanArrayRegion(static_cast<jbooleanArray>(javaArray()), 0, m_length, reinterpret_cast<jboolean*>(view->typedVector()));
+            result = view;
+            break;
+        }
+
+    case JavaTypeByte:
+        {
+            auto* view = JSInt8Array::create(globalObject, globalObject->typedArrayStructure(TypeInt8), m_length);
+            RETURN_IF_EXCEPTION(scope, { });
+            env->GetByteArrayRegion(static_cast<jbyteArray>(javaArray()), 0, m_length, reinterpret_cast<jbyte*>(view->typedVector()));
+            result = view;
+            break;
+        }
+
+    case JavaTypeChar:
+        {
+            auto* view = JSUint16Array::create(globalObject, globalObject->typedArrayStructure(TypeUint16), m_length);
+            RETURN_IF_EXCEPTION(scope, { });
+            env->GetCharArrayRegion(static_cast<jcharArray>(javaArray()), 0, m_length, reinterpret_cast<jchar*>(view->typedVector()));
+            result = view;
+            break;
+        }
+
+    case JavaTypeShort:
+        {
+            auto* view = JSInt16Array::create(globalObject, globalObject->typedArrayStructure(TypeInt16), m_length);
+            RETURN_IF_EXCEPTION(scope, { });
+            env->GetShortArrayRegion(static_cast<jshortArray>(javaArray()), 0, m_length, reinterpret_cast<jshort*>(view->typedVector()));
+            result = view;
+            break;
+        }
+
+    case JavaTypeInt:
+        {
+            auto* view = JSInt32Array::create(globalObject, globalObject->typedArrayStructure(TypeInt32), m_length);
+            RETURN_IF_EXCEPTION(scope, { });
+            env->GetIntArrayRegion(static_cast<jintArray>(javaArray()), 0, m_length, reinterpret_cast<jint*>(view->typedVector()));
+            result = view;
+            break;
+        }
+
+    case JavaTypeLong:
+        {
+            // Elements read one by one are converted to numbers, so are these
+            auto* view = JSFloat64Array::create(globalObject, globalObject->typedArrayStructure(TypeFloat64), m_length);
+            RETURN_IF_EXCEPTION(scope, { });
+            Vector<jlong> longs(m_length);
+            env->GetLongArrayRegion(static_cast<jlongArray>(javaArray()), 0, m_length, longs.data());
+            double* doubles = view->typedVector();
+            for (unsigned i = 0; i < m_length; i++)
+                doubles[i] = static_cast<double>(longs[i]);
+            result = view;
+            break;
+        }
+
+    case JavaTypeFloat:
+        {
+            auto* view = JSFloat32Array::create(globalObject, globalObject->typedArrayStructure(TypeFloat32), m_length);
+            RETURN_IF_EXCEPTION(scope, { });
+            env->GetFloatArrayRegion(static_cast<jfloatArray>(javaArray()), 0, m_length, reinterpret_cast<jfloat*>(view->typedVector()));
+            result = view;
+            break;
+        }
+
+    case JavaTypeDouble:
+        {
+            auto* view = JSFloat64Array::create(globalObject, globalObject->typedArrayStructure(TypeFloat64), m_length);
+            RETURN_IF_EXCEPTION(scope, { });
+            env->GetDoubleArrayRegion(static_cast<jdoubleArray>(javaArray()), 0, m_length, reinterpret_cast<jdouble*>(view->typedVector()));
+            result = view;
+            break;
+        }
+
+    default:
+        throwTypeError(globalObject, scope, "Only arrays of primitive types can be copied to a typed array"_s);
+        return { };
+    }
+
+    if (WTF::CheckAndClearException(env))
+        return jsUndefined();
+    return result;
+}
+
 #endif // ENABLE(JAVA_BRIDGE)
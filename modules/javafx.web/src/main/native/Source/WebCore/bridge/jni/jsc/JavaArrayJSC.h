@@ -47,6 +47,7 @@ public:
     bool setValueAt(JSGlobalObject*, unsigned int index, JSValue) const final;
     JSValue valueAt(JSGlobalObject*, unsigned int index) const final;
     unsigned int getLength() const final;
+    JSValue toTypedArray(JSGlobalObject*) const final;
 
     jobject javaArray() const { return m_array->instance(); }
     jobject accessControlContext() const { return m_accessControlContext->instance(); }
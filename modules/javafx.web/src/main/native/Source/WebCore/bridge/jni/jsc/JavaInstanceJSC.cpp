@@ -335,13 +335,12 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         }
 
         // const char *callingURL = 0; // FIXME, need to propagate calling URL to Java
-        jmethodID methodId = getMethodID(obj, jMethod->name().utf8().data(), jMethod->signature());
-
         jthrowable ex = dispatchJNICall(callFrame->argumentCount(), rootObject,
                                         obj, jMethod->isStatic(),
-                                        jMethod->returnType(), methodId,
+                                        jMethod->returnType(), jMethod->methodID(),
                                         jArgs.data(), result,
-                                        accessControlContext());
+                                        accessControlContext(),
+                                        jMethod->reflectedMethod());
         if (ex != NULL) {
             JSValue exceptionDescription
               = (JavaInstance::create(ex, rootObject, accessControlContext())
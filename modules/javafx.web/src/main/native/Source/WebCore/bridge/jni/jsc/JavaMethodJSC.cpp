@@ -77,6 +77,11 @@ JavaMethod::JavaMethod(JNIEnv* env, jobject aMethod)
 
     jint modifiers = callJNIMethod<jint>(aMethod, "getModifiers", "()I");
     m_isStatic = (modifiers & 0x8) != 0;
+
+    // Keep the reflected method and its ID, so that calls from JavaScript
+    // do not look them up again.
+    m_method = JobjectWrapper::create(aMethod, true);
+    m_methodID = env->FromReflectedMethod(aMethod);
 }
 
 JavaMethod::~JavaMethod()
@@ -30,6 +30,7 @@
 
 #include "Bridge.h"
 #include "JavaType.h"
+#include "JobjectWrapper.h"
 
 #include "JavaStringJSC.h"
 
@@ -50,6 +51,8 @@ public:
     const char* signature() const;
     JavaType returnType() const { return m_returnType; }
     bool isStatic() const { return m_isStatic; }
+    jmethodID methodID() const { return m_methodID; }
+    jobject reflectedMethod() const { return m_method->instance(); }
 
     // Method implementation
     int numParameters() const { return m_parameters.size(); }
@@ -61,6 +64,8 @@ private:
     JavaString m_returnTypeClassName;
     JavaType m_returnType;
     bool m_isStatic;
+    RefPtr<JobjectWrapper> m_method;
+    jmethodID m_methodID;
 };
 
 } // namespace Bindings
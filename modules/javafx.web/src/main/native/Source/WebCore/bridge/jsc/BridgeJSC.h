@@ -125,6 +125,8 @@ public:
     virtual bool setValueAt(JSGlobalObject*, unsigned index, JSValue) const = 0;
     virtual JSValue valueAt(JSGlobalObject*, unsigned index) const = 0;
     virtual unsigned int getLength() const = 0;
+    // Copies the elements into a new typed array, for toTypedArray()
+    virtual JSValue toTypedArray(JSGlobalObject*) const = 0;
 
 protected:
     RefPtr<RootObject> m_rootObject;
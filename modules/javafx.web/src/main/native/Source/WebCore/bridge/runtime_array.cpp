@@ -40,6 +40,7 @@ namespace JSC {
 const ClassInfo RuntimeArray::s_info = { "RuntimeArray"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(RuntimeArray) };
 
 static JSC_DECLARE_CUSTOM_GETTER(arrayLengthGetter);
+static JSC_DECLARE_HOST_FUNCTION(runtimeArrayToTypedArray);
 
 RuntimeArray::RuntimeArray(VM& vm, Structure* structure)
     : JSArray(vm, structure, nullptr)
@@ -52,6 +53,9 @@ void RuntimeArray::finishCreation(VM& vm, Bindings::Array* array)
     Base::finishCreation(vm);
     ASSERT(inherits(info()));
     m_array = array;
+    putDirect(vm, Identifier::fromString(vm, "toTypedArray"_s),
+        JSFunction::create(vm, globalObject(), 0, "toTypedArray"_s, runtimeArrayToTypedArray, ImplementationVisibility::Public),
+        static_cast<unsigned>(PropertyAttribute::DontEnum));
 }
 
 RuntimeArray::~RuntimeArray()
@@ -75,6 +79,17 @@ JSC_DEFINE_CUSTOM_GETTER(arrayLengthGetter, (JSGlobalObject* lexicalGlobalObject
     return JSValue::encode(jsNumber(thisObject->getLength()));
 }
 
+JSC_DEFINE_HOST_FUNCTION(runtimeArrayToTypedArray, (JSGlobalObject* lexicalGlobalObject, CallFrame* callFrame))
+{
+    VM& vm = lexicalGlobalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    RuntimeArray* thisObject = jsDynamicCast<RuntimeArray*>(callFrame->thisValue());
+    if (!thisObject || !thisObject->getConcreteArray())
+        return throwVMTypeError(lexicalGlobalObject, scope);
+    RELEASE_AND_RETURN(scope, JSValue::encode(thisObject->getConcreteArray()->toTypedArray(lexicalGlobalObject)));
+}
+
 void RuntimeArray::getOwnPropertyNames(JSObject* object, JSGlobalObject* lexicalGlobalObject, PropertyNameArray& propertyNames, DontEnumPropertiesMode mode)
 {
     VM& vm = lexicalGlobalObject->vm();
@@ -5291,8 +5291,20 @@ void HTMLMediaElement::mediaPlayerResourceNotSupported()
 void HTMLMediaElement::mediaPlayerRepaint()
 {
     beginProcessingMediaPlayerCallback();
+#if PLATFORM(JAVA)
+    // A new frame only changes the video content, not the border or
+    // padding of the element.
+    if (auto* renderer = this->renderer()) {
+        if (is<RenderVideo>(*renderer)) {
+            auto& renderVideo = downcast<RenderVideo>(*renderer);
+            renderVideo.repaintRectangle(renderVideo.videoBox());
+        } else
+            renderer->repaint();
+    }
+#else
     if (auto* renderer = this->renderer())
         renderer->repaint();
+#endif
     endProcessingMediaPlayerCallback();
 }
 
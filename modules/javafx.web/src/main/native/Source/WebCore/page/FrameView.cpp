@@ -2964,6 +2964,11 @@ void FrameView::repaintContentRectangle(const IntRect& r)
     if (!shouldUpdate())
         return;
 
+#if PLATFORM(JAVA)
+    if (!visibleContentRect().contains(r))
+        ++m_offscreenRepaintCount;
+#endif
+
     ScrollView::repaintContentRectangle(r);
 }
 
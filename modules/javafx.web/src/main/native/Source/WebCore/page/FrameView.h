@@ -349,6 +349,11 @@ public:
     const WeakHashSet<RenderLayerModelObject>* viewportConstrainedObjects() const { return m_viewportConstrainedObjects.get(); }
     bool hasViewportConstrainedObjects() const { return m_viewportConstrainedObjects && !m_viewportConstrainedObjects->computesEmpty(); }
 
+#if PLATFORM(JAVA)
+    // Number of repaints that fell at least partially outside of the visible content.
+    unsigned offscreenRepaintCount() const { return m_offscreenRepaintCount; }
+#endif
+
     float frameScaleFactor() const;
 
     // Functions for querying the current scrolled position, negating the effects of overhang
@@ -1038,6 +1043,9 @@ private:
     // True if autosize has been run since m_shouldAutoSize was set.
     bool m_didRunAutosize { false };
     bool m_inUpdateEmbeddedObjects { false };
+#if PLATFORM(JAVA)
+    unsigned m_offscreenRepaintCount { 0 };
+#endif
 };
 
 inline void FrameView::incrementVisuallyNonEmptyPixelCount(const IntSize& size)
@@ -148,6 +148,10 @@ public:
         Exclude
     };
     float widthForGlyph(Glyph, SyntheticBoldInclusion = SyntheticBoldInclusion::Incorporate) const;
+#if PLATFORM(JAVA)
+    // Seeds the width cache with advances fetched in bulk by GlyphPage::fill.
+    void cacheWidthForGlyph(Glyph glyph, float width) const { m_glyphToWidthMap.setMetricsForGlyph(glyph, width); }
+#endif
 
     const Path& pathForGlyph(Glyph) const; // Don't store the result of this! The hash map is free to rehash at any point, leaving this reference dangling.
 
@@ -110,6 +110,9 @@ public:
 #endif
 #if USE(CAIRO)
     explicit Path(RefPtr<cairo_t>&&);
+#endif
+#if PLATFORM(JAVA)
+    explicit Path(RefPtr<RQRef>&&);
 #endif
     WEBCORE_EXPORT ~Path();
 
@@ -186,6 +189,8 @@ public:
     WEBCORE_EXPORT PlatformPathPtr platformPath() const;
 #elif USE(CAIRO)
     cairo_t* cairoPath() const { return m_path.get(); }
+#elif PLATFORM(JAVA)
+    PlatformPathPtr platformPath() const;
 #else
     PlatformPathPtr platformPath() const { return m_path; }
 #endif
@@ -255,6 +260,11 @@ private:
     void appendElement(PathElement::Type, Vector<FloatPoint, 3>&&);
 #endif
 
+#if PLATFORM(JAVA)
+    void appendPendingSegment(jint type, std::initializer_list<FloatPoint>);
+    void flushPendingSegments() const;
+#endif
+
 #if USE(CAIRO)
     RefPtr<cairo_t> m_path;
 #else
@@ -270,6 +280,13 @@ private:
 #if USE(CAIRO)
     std::optional<Vector<PathElement>> m_elements;
 #endif
+#if PLATFORM(JAVA)
+    // Segments added by moveTo(), addLineTo(), the curve methods and
+    // closeSubpath() are kept here and passed to the Java path in a single
+    // call the next time it is used.
+    mutable Vector<jint> m_pendingSegmentTypes;
+    mutable Vector<jfloat> m_pendingSegmentCoords;
+#endif
 };
 
 WEBCORE_EXPORT WTF::TextStream& operator<<(WTF::TextStream&, const Path&);
@@ -43,128 +43,66 @@ jclass PG_GetTextRun(JNIEnv* env)
     return textRunCls;
 }
 
-bool jIsLTR(jobject jRun)
+// Layout of the array returned by WCTextRun.getGlyphData(), see WCTextRun.java.
+enum {
+    RunFlags = 0,
+    RunStart,
+    RunEnd,
+    RunGlyphCount,
+    RunInitialAdvanceX,
+    RunInitialAdvanceY,
+    RunHeaderSize
+};
+
+enum {
+    GlyphCode = 0,
+    GlyphCharOffset,
+    GlyphAdvance,
+    GlyphSize
+};
+
+constexpr jint RunFlagLeftToRight = 1;
+
+Vector<jint> jGetGlyphData(jobject jRun)
 {
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mID = env->GetMethodID(
         PG_GetTextRun(env),
-        "isLeftToRight",
-        "()Z");
+        "getGlyphData",
+        "()[I");
     ASSERT(mID);
 
-    return env->CallBooleanMethod(jRun, mID) == JNI_TRUE;
-}
-
-unsigned jGetGlyphCount(jobject jRun)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyphCount",
-        "()I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID);
-}
-
-unsigned jGetStart(jobject jRun)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getStart",
-        "()I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID);
-}
-
-unsigned jGetEnd(jobject jRun)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getEnd",
-        "()I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID);
-}
-
-unsigned jGetCharOffset(jobject jRun, unsigned glyphIndex)
-{
-    if (!jGetGlyphCount(jRun)) {
-        // Return same value as TextRun.getCharOffset() when there is
-        // no glyph information available.
-        return glyphIndex;
-    }
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getCharOffset",
-        "(I)I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID, glyphIndex);
-}
-
-CGGlyph jGetGlyph(jobject jRun, unsigned glyphIndex)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyph",
-        "(I)I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID, glyphIndex);
-}
-
-FloatRect jGetGlyphPosAndAdvance(jobject jRun, unsigned glyphIndex)
-{
-    if (!jGetGlyphCount(jRun)) {
+    JLocalRef<jintArray> jData(static_cast<jintArray>(env->CallObjectMethod(jRun, mID)));
+    if (WTF::CheckAndClearException(env) || !jData)
         return { };
-    }
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyphPosAndAdvance",
-        "(I)[F");
-    ASSERT(mID);
-
-    JLocalRef<jfloatArray> jpos = static_cast<jfloatArray> (env->CallObjectMethod(
-                                                              jRun, mID, glyphIndex));
-    WTF::CheckAndClearException(env);
 
-    jfloat* pos = static_cast<float*>(env->GetPrimitiveArrayCritical(jpos, 0));
-    FloatRect rect = { pos[0], pos[1], pos[2], pos[3] };
-    env->ReleasePrimitiveArrayCritical(jpos, pos, 0);
-    return rect;
-}
+    jsize length = env->GetArrayLength(jData);
+    if (length < RunHeaderSize)
+        return { };
 
-FloatSize jGetInitialAdvance(JLObject jRun)
-{
-    // FIXME(arajkumar): There is no way to get initial advance from Prism Font implementation.
-    // With trial and error I found that glyph 0's x,y position can be used as an alternative
-    // for initial advance.
-    return jGetGlyphPosAndAdvance(jRun, 0).location() - FloatPoint();
+    Vector<jint> data(length);
+    env->GetIntArrayRegion(jData, 0, length, data.data());
+    return data;
 }
 
 }
 
-ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
-    : m_initialAdvance(jGetInitialAdvance(jRun))
+ComplexTextController::ComplexTextRun::ComplexTextRun(const Vector<jint>& data, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
+    // There is no way to get initial advance from Prism Font implementation,
+    // glyph 0's x,y position is packed in its place.
+    : m_initialAdvance(bitwise_cast<float>(data[RunInitialAdvanceX]), bitwise_cast<float>(data[RunInitialAdvanceY]))
     , m_font(font)
     , m_characters(characters)
     , m_stringLength(stringLength)
-    , m_indexBegin(jGetStart(jRun))
-    , m_indexEnd(jGetEnd(jRun))
-    , m_glyphCount(jGetGlyphCount(jobject(jRun)))
+    , m_indexBegin(data[RunStart])
+    , m_indexEnd(data[RunEnd])
+    , m_glyphCount(data[RunGlyphCount])
     , m_stringLocation(stringLocation)
-    , m_isLTR(jIsLTR(jobject(jRun)))
+    , m_isLTR(data[RunFlags] & RunFlagLeftToRight)
 {
+    ASSERT(data.size() == RunHeaderSize + m_glyphCount * GlyphSize);
+    const jint* glyphData = data.data() + RunHeaderSize;
+    unsigned shapedGlyphCount = m_glyphCount;
     if (!m_glyphCount) {
         // There won't be any glyph when TextRun contains a line break or a soft break.
         // However WebCore expects us to return a empty value for all of it's query,
@@ -178,21 +116,27 @@ ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font&
     // m_glyphOrigins.grow(m_glyphCount);
     m_coreTextIndices.grow(m_glyphCount);
 
-    for (unsigned i = 0; i < m_glyphCount; ++i) {
+    if (!shapedGlyphCount) {
+        m_glyphs[0] = 0;
+        m_baseAdvances[0] = { };
+        m_coreTextIndices[0] = m_indexBegin;
+        return;
+    }
+
+    for (unsigned i = 0; i < m_glyphCount; ++i, glyphData += GlyphSize) {
         // The given string will be broken down into multiple java TextRuns. Each
         // java TextRun will have indicies relative to it's text. So it has to
         // be converted to absolute index w.r.t WebCore String.
         // Refer {CTGlyphLayout, DWGlyphLayout, PangoGlyphLayout}.layout()
-        m_coreTextIndices[i] = m_indexBegin + jGetCharOffset(jRun, i);
+        m_coreTextIndices[i] = m_indexBegin + glyphData[GlyphCharOffset];
 
-        m_glyphs[i]= jGetGlyph(jRun, i);
+        m_glyphs[i] = glyphData[GlyphCode];
         if (m_font.isZeroWidthSpaceGlyph(m_glyphs[i])) {
             m_baseAdvances[i] = { };
             continue;
         }
 
-        auto glyphBox = jGetGlyphPosAndAdvance(jRun, i);
-        m_baseAdvances[i] = glyphBox.size();
+        m_baseAdvances[i] = { bitwise_cast<float>(glyphData[GlyphAdvance]), 0 };
     }
 }
 
@@ -224,9 +168,13 @@ void ComplexTextController::collectComplexTextRunsForCharacters(const UChar* cha
         return;
     }
 
-    for (auto i = 0; i < env->GetArrayLength(jobjectArray(jRuns)); i++) {
-        auto jRun = env->GetObjectArrayElement(jobjectArray(jRuns), i);
-        m_complexTextRuns.append(ComplexTextRun::create(jRun, *font, characters, stringLocation, length));
+    jsize runCount = env->GetArrayLength(jobjectArray(jRuns));
+    for (jsize i = 0; i < runCount; i++) {
+        JLObject jRun(env->GetObjectArrayElement(jobjectArray(jRuns), i));
+        auto data = jGetGlyphData(jRun);
+        if (data.isEmpty())
+            continue;
+        m_complexTextRuns.append(ComplexTextRun::create(data, *font, characters, stringLocation, length));
     }
 }
 
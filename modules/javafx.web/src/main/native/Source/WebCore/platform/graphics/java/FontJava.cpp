@@ -152,18 +152,33 @@ FloatRect Font::platformBoundsForGlyph(Glyph c) const
     static jmethodID getGlyphBoundingBox_mID = env->GetMethodID(PG_GetFontClass(env), "getGlyphBoundingBox", "(I)[F");
     ASSERT(getGlyphBoundingBox_mID);
 
-    jfloatArray boundingBox = (jfloatArray)env->CallObjectMethod(*jFont, getGlyphBoundingBox_mID, (jint)c);
-    jfloat *bBox = env->GetFloatArrayElements(boundingBox,0);
-    auto bb = FloatRect { bBox[0], bBox[1], bBox[2], bBox[3] };
-    env->ReleaseFloatArrayElements(boundingBox, bBox, 0);
-    WTF::CheckAndClearException(env);
-    return bb;
+    JLocalRef<jfloatArray> boundingBox(static_cast<jfloatArray>(env->CallObjectMethod(*jFont, getGlyphBoundingBox_mID, (jint)c)));
+    if (WTF::CheckAndClearException(env) || !boundingBox)
+        return {};
+
+    jfloat bBox[4];
+    env->GetFloatArrayRegion(boundingBox, 0, 4, bBox);
+    return FloatRect { bBox[0], bBox[1], bBox[2], bBox[3] };
 }
 
-Path Font::platformPathForGlyph(Glyph) const
+Path Font::platformPathForGlyph(Glyph c) const
 {
-    notImplemented();
-    return Path();
+    // Font::pathForGlyph() keeps the result in m_glyphPathMap, so the outline
+    // is fetched from the Java font only once per glyph and font.
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    RefPtr<RQRef> jFont = m_platformData.nativeFontData();
+    if (!jFont)
+        return Path();
+
+    static jmethodID getGlyphPath_mID = env->GetMethodID(PG_GetFontClass(env), "getGlyphPath", "(I)Lcom/sun/webkit/graphics/WCPath;");
+    ASSERT(getGlyphPath_mID);
+
+    JLObject path(env->CallObjectMethod(*jFont, getGlyphPath_mID, (jint)c));
+    if (WTF::CheckAndClearException(env) || !path)
+        return Path();
+
+    return Path(RQRef::create(path));
 }
 
 bool Font::platformSupportsCodePoint(UChar32 character, std::optional<UChar32> variation) const
@@ -81,6 +81,23 @@ bool GlyphPage::fill(UChar* buffer, unsigned bufferLength)
     }
     env->ReleasePrimitiveArrayCritical(jglyphs, glyphs, JNI_ABORT);
 
+    if (haveGlyphs) {
+        // Fetch the advances of the whole page in one call, rather than
+        // one getGlyphWidth call per glyph during layout.
+        static jmethodID getGlyphWidthsMID = env->GetMethodID(PG_GetFontClass(env), "getGlyphWidths", "([I)[F");
+        ASSERT(getGlyphWidthsMID);
+        JLocalRef<jfloatArray> jwidths(static_cast<jfloatArray>(env->CallObjectMethod(*jFont, getGlyphWidthsMID, (jintArray)jglyphs)));
+        WTF::CheckAndClearException(env);
+        if (jwidths) {
+            Vector<jfloat> widths(bufferLength);
+            env->GetFloatArrayRegion(jwidths, 0, bufferLength, widths.data());
+            for (unsigned i = 0; i < GlyphPage::size; i++) {
+                if (Glyph glyph = glyphForIndex(i))
+                    this->font().cacheWidthForGlyph(glyph, widths[i * step]);
+            }
+        }
+    }
+
     return haveGlyphs;
 }
 
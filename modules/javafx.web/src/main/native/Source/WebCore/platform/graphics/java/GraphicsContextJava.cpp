@@ -25,6 +25,7 @@
 
 #include "config.h"
 
+#include <algorithm>
 #include <math.h>
 #include <stdio.h>
 #include <wtf/MathExtras.h>
@@ -63,6 +64,38 @@
 
 namespace WebCore {
 
+// Per opcode counters of the state commands encoded and elided by the state
+// shadow of PlatformContextJava. Read and reset on the Event thread by
+// WCRenderQueue.twkGetStateCounters.
+static jint stateCommandsEncoded[com_sun_webkit_graphics_GraphicsDecoder_OPCODE_COUNT];
+static jint stateCommandsElided[com_sun_webkit_graphics_GraphicsDecoder_OPCODE_COUNT];
+static jint stateBytesElided;
+
+static inline void stateCommandEncoded(jint opcode)
+{
+    stateCommandsEncoded[opcode]++;
+}
+
+static inline void stateCommandElided(jint opcode, int size)
+{
+    stateCommandsElided[opcode]++;
+    stateBytesElided += size;
+}
+
+// Returns true if the java side does not hold the value yet, in which case
+// the caller has to encode the state command. The value is recorded as known.
+template<typename T>
+static bool needsStateCommand(std::optional<T>& known, const T& value, jint opcode, int size)
+{
+    if (known && *known == value) {
+        stateCommandElided(opcode, size);
+        return false;
+    }
+    known = value;
+    stateCommandEncoded(opcode);
+    return true;
+}
+
 static void setGradient(Gradient &gradient,
     const AffineTransform& gradientSpaceTransformation, PlatformGraphicsContext* context, jint id)
 {
@@ -115,6 +148,13 @@ static void setGradient(Gradient &gradient,
         context->rq()
         << r << g << b << a << (jfloat)cs.offset;
     }
+
+    // The gradient replaces the paint the color shadow refers to.
+    if (id == com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT)
+        context->stateShadow().fillColor.reset();
+    else
+        context->stateShadow().strokeColor.reset();
+    stateCommandEncoded(id);
 }
 
 static void flushImageRQ(PlatformGraphicsContext* context, const PlatformImagePtr& image)
@@ -162,6 +202,8 @@ void GraphicsContextJava::savePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+    platformContext()->saveStateShadow();
+    stateCommandEncoded(com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE);
 }
 
 void GraphicsContextJava::restore() {
@@ -176,6 +218,8 @@ void GraphicsContextJava::restorePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+    platformContext()->restoreStateShadow();
+    stateCommandEncoded(com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE);
 }
 
 // Draws a filled rectangle with a stroked border.
@@ -485,7 +529,13 @@ void GraphicsContextJava::translate(float x, float y)
     if (paintingDisabled())
         return;
 
+    if (!x && !y) {
+        stateCommandElided(com_sun_webkit_graphics_GraphicsDecoder_TRANSLATE, 12);
+        return;
+    }
+
     m_state.transform.translate(x, y);
+    stateCommandEncoded(com_sun_webkit_graphics_GraphicsDecoder_TRANSLATE);
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_TRANSLATE
     << x << y;
@@ -497,6 +547,10 @@ void GraphicsContextJava::setPlatformFillColor(const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    if (!needsStateCommand(platformContext()->stateShadow().fillColor, std::array<float, 4> { r, g, b, a },
+            com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR, 20))
+        return;
+
     platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
     << r << g << b << a;
@@ -507,6 +561,12 @@ void GraphicsContextJava::setPlatformTextDrawingMode(TextDrawingModeFlags mode)
     if (paintingDisabled())
         return;
 
+    jint textMode = (mode.contains(TextDrawingMode::Fill) ? 1 : 0)
+        | (mode.contains(TextDrawingMode::Stroke) ? 2 : 0);
+    if (!needsStateCommand(platformContext()->stateShadow().textMode, textMode,
+            com_sun_webkit_graphics_GraphicsDecoder_SET_TEXT_MODE, 16))
+        return;
+
     platformContext()->rq().freeSpace(16)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_TEXT_MODE
     << (jint)(mode.contains(TextDrawingMode::Fill))
@@ -521,6 +581,10 @@ void GraphicsContextJava::setPlatformStrokeStyle(StrokeStyle style)
     if (paintingDisabled())
         return;
 
+    if (!needsStateCommand(platformContext()->stateShadow().strokeStyle, (jint)style,
+            com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE, 8))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
     << (jint)style;
@@ -532,6 +596,10 @@ void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    if (!needsStateCommand(platformContext()->stateShadow().strokeColor, std::array<float, 4> { r, g, b, a },
+            com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR, 20))
+        return;
+
     platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
     << r << g << b << a;
@@ -542,6 +610,10 @@ void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
     if (paintingDisabled())
         return;
 
+    if (!needsStateCommand(platformContext()->stateShadow().strokeThickness, strokeThickness,
+            com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH, 8))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
     << strokeThickness;
@@ -567,7 +639,13 @@ void GraphicsContextJava::concatCTM(const AffineTransform& at)
     if (paintingDisabled())
         return;
 
+    if (at.isIdentity()) {
+        stateCommandElided(com_sun_webkit_graphics_GraphicsDecoder_CONCATTRANSFORM_FFFFFF, 28);
+        return;
+    }
+
     m_state.transform.multiply(at);
+    stateCommandEncoded(com_sun_webkit_graphics_GraphicsDecoder_CONCATTRANSFORM_FFFFFF);
     platformContext()->rq().freeSpace(28)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_CONCATTRANSFORM_FFFFFF
     << (float)at.a() << (float)at.b() << (float)at.c() << (float)at.d() << (float)at.e() << (float)at.f();
@@ -600,6 +678,10 @@ void GraphicsContextJava::setPlatformShadow(const FloatSize& s, float blur, cons
     }
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    if (!needsStateCommand(platformContext()->stateShadow().shadow, std::array<float, 7> { width, height, blur, r, g, b, a },
+            com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW, 32))
+        return;
+
     platformContext()->rq().freeSpace(32)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW
     << width << height << blur << r << g << b << a;;
@@ -620,6 +702,12 @@ void GraphicsContextJava::beginTransparencyLayer(float opacity)
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_BEGINTRANSPARENCYLAYER
     << opacity;
+
+    // The java layer saves the state like SAVESTATE does and may reset the
+    // composite operation of the new state.
+    platformContext()->saveStateShadow();
+    platformContext()->stateShadow().compositeOperation.reset();
+    stateCommandEncoded(com_sun_webkit_graphics_GraphicsDecoder_BEGINTRANSPARENCYLAYER);
 }
 
 void GraphicsContextJava::endTransparencyLayer()
@@ -629,6 +717,8 @@ void GraphicsContextJava::endTransparencyLayer()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER;
+    platformContext()->restoreStateShadow();
+    stateCommandEncoded(com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER);
 
     GraphicsContext::endTransparencyLayer();
 }
@@ -669,6 +759,11 @@ void GraphicsContextJava::setLineDash(const DashArray& dashes, float dashOffset)
     }
     size_t size = dashes.size();
 
+    platformContext()->setLineDash(dashes, dashOffset);
+    if (!needsStateCommand(platformContext()->stateShadow().lineDash, std::make_pair(dashOffset, dashes),
+            com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_DASH, (int)(3 + size) * 4))
+        return;
+
     platformContext()->rq().freeSpace((3 + size) * 4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_DASH
     << dashOffset
@@ -678,8 +773,6 @@ void GraphicsContextJava::setLineDash(const DashArray& dashes, float dashOffset)
         platformContext()->rq()
         << (float) dashes.at(i);
     }
-
-    platformContext()->setLineDash(dashes, dashOffset);
 }
 
 void GraphicsContextJava::setLineCap(LineCap cap)
@@ -688,11 +781,14 @@ void GraphicsContextJava::setLineCap(LineCap cap)
       return;
     }
 
+    platformContext()->setLineCap(cap);
+    if (!needsStateCommand(platformContext()->stateShadow().lineCap, (jint)cap,
+            com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_CAP, 8))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_CAP
     << (jint)cap;
-
-    platformContext()->setLineCap(cap);
 }
 
 void GraphicsContextJava::setLineJoin(LineJoin join)
@@ -700,11 +796,14 @@ void GraphicsContextJava::setLineJoin(LineJoin join)
     if (paintingDisabled())
         return;
 
+    platformContext()->setLineJoin(join);
+    if (!needsStateCommand(platformContext()->stateShadow().lineJoin, (jint)join,
+            com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_JOIN, 8))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_JOIN
     << (jint)join;
-
-    platformContext()->setLineJoin(join);
 }
 
 void GraphicsContextJava::setMiterLimit(float limit)
@@ -712,15 +811,22 @@ void GraphicsContextJava::setMiterLimit(float limit)
     if (paintingDisabled())
         return;
 
+    platformContext()->setMiterLimit(limit);
+    if (!needsStateCommand(platformContext()->stateShadow().miterLimit, limit,
+            com_sun_webkit_graphics_GraphicsDecoder_SET_MITER_LIMIT, 8))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_MITER_LIMIT
     << (jfloat)limit;
-
-    platformContext()->setMiterLimit(limit);
 }
 
 void GraphicsContextJava::setPlatformAlpha(float alpha)
 {
+    if (!needsStateCommand(platformContext()->stateShadow().alpha, alpha,
+            com_sun_webkit_graphics_GraphicsDecoder_SETALPHA, 8))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETALPHA
     << alpha;
@@ -731,6 +837,10 @@ void GraphicsContextJava::setPlatformCompositeOperation(CompositeOperator op, Bl
     if (paintingDisabled())
         return;
 
+    if (!needsStateCommand(platformContext()->stateShadow().compositeOperation, (jint)op,
+            com_sun_webkit_graphics_GraphicsDecoder_SETCOMPOSITE, 8))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETCOMPOSITE
     << (jint)op;
@@ -905,7 +1015,13 @@ void GraphicsContextJava::rotate(float radians)
     if (paintingDisabled())
         return;
 
+    if (!radians) {
+        stateCommandElided(com_sun_webkit_graphics_GraphicsDecoder_ROTATE, 2 * 4);
+        return;
+    }
+
     m_state.transform.rotate(radians);
+    stateCommandEncoded(com_sun_webkit_graphics_GraphicsDecoder_ROTATE);
     platformContext()->rq().freeSpace(2 * 4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_ROTATE
     << radians;
@@ -917,7 +1033,13 @@ void GraphicsContextJava::scale(const FloatSize& size)
     if (paintingDisabled())
         return;
 
+    if (size.width() == 1 && size.height() == 1) {
+        stateCommandElided(com_sun_webkit_graphics_GraphicsDecoder_SCALE, 12);
+        return;
+    }
+
     m_state.transform.scale(size.width(), size.height());
+    stateCommandEncoded(com_sun_webkit_graphics_GraphicsDecoder_SCALE);
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SCALE
     << size.width() << size.height();
@@ -1056,6 +1178,7 @@ void GraphicsContextJava::setCTM(const AffineTransform& tm)
         return;
 
     m_state.transform = tm;
+    stateCommandEncoded(com_sun_webkit_graphics_GraphicsDecoder_SET_TRANSFORM);
     platformContext()->rq().freeSpace(28)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_TRANSFORM
     << (float)tm.a() << (float)tm.b() << (float)tm.c() << (float)tm.d() << (float)tm.e() << (float)tm.f();
@@ -1072,3 +1195,20 @@ void Gradient::fill(GraphicsContext& gc, const FloatRect& rect)
 }
 
 } // namespace WebCore
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkGetStateCounters
+    (JNIEnv* env, jclass, jintArray encoded, jintArray elided)
+{
+    using namespace WebCore;
+
+    jsize count = std::min<jsize>(env->GetArrayLength(encoded), com_sun_webkit_graphics_GraphicsDecoder_OPCODE_COUNT);
+    env->SetIntArrayRegion(encoded, 0, count, stateCommandsEncoded);
+    count = std::min<jsize>(env->GetArrayLength(elided), com_sun_webkit_graphics_GraphicsDecoder_OPCODE_COUNT);
+    env->SetIntArrayRegion(elided, 0, count, stateCommandsElided);
+
+    jint bytesElided = stateBytesElided;
+    std::fill(std::begin(stateCommandsEncoded), std::end(stateCommandsEncoded), 0);
+    std::fill(std::begin(stateCommandsElided), std::end(stateCommandsElided), 0);
+    stateBytesElided = 0;
+    return bytesElided;
+}
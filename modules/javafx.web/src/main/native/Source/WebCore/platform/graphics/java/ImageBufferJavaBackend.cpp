@@ -139,11 +139,16 @@ Vector<uint8_t> ImageBufferJavaBackend::toDataJava(const String& mimeType, std::
 
 void *ImageBufferJavaBackend::getData() const
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-
     //RenderQueue need to be processed before pixel buffer extraction.
     //For that purpose it has to be in actual state.
-    context().platformContext()->rq().flushBuffer();
+    RenderingQueue& rq = context().platformContext()->rq();
+    rq.flushBuffer();
+    if (m_data && rq.flushCount() == m_dataFlushCount) {
+        // Nothing was drawn since the pixels were read
+        return m_data;
+    }
+
+    JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midGetBGRABytes = env->GetMethodID(
         PG_GetImageClass(env),
@@ -157,20 +162,28 @@ void *ImageBufferJavaBackend::getData() const
     }
     JLObject byteBuffer(pixelBuf);
 
-    return env->GetDirectBufferAddress(byteBuffer);
+    m_pixelBuffer = byteBuffer;
+    m_data = env->GetDirectBufferAddress(byteBuffer);
+    m_dataFlushCount = rq.flushCount();
+    return m_data;
 }
 
-void ImageBufferJavaBackend::update() const
+void ImageBufferJavaBackend::update(const IntRect& rect) const
 {
+    if (rect.isEmpty()) {
+        return;
+    }
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midUpdateByteBuffer = env->GetMethodID(
         PG_GetImageClass(env),
         "drawPixelBuffer",
-        "()V");
+        "(IIII)V");
     ASSERT(midUpdateByteBuffer);
 
-    env->CallObjectMethod(getWCImage(), midUpdateByteBuffer);
+    env->CallVoidMethod(getWCImage(), midUpdateByteBuffer,
+        (jint)rect.x(), (jint)rect.y(), (jint)rect.width(), (jint)rect.height());
     WTF::CheckAndClearException(env);
 }
 
@@ -210,7 +223,6 @@ void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer
         return;
 
     putPixelBuffer(sourcePixelBuffer, srcRect, dstPoint, destFormat, data);
-    update();
 }
 
 RefPtr<PixelBuffer> ImageBufferJavaBackend::getPixelBuffer(const PixelBufferFormat& outputFormat, const IntRect& srcRect, void* data, const ImageBufferAllocator& allocator) const
@@ -222,7 +234,18 @@ void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer
     const IntRect& srcRect, const IntPoint& dstPoint, AlphaPremultiplication destFormat, void* data)
 {
     ImageBufferBackend::putPixelBuffer(sourcePixelBuffer, srcRect, dstPoint, destFormat, data);
-    update();
+
+    // Only the written rect is uploaded, computed as in ImageBufferBackend
+    auto sourceRectScaled = toBackendCoordinates(srcRect);
+    auto destinationRect = intersection({ IntPoint::zero(), sourcePixelBuffer.size() }, sourceRectScaled);
+    destinationRect.moveBy(toBackendCoordinates(dstPoint));
+    if (sourceRectScaled.x() < 0)
+        destinationRect.setX(destinationRect.x() - sourceRectScaled.x());
+    if (sourceRectScaled.y() < 0)
+        destinationRect.setY(destinationRect.y() - sourceRectScaled.y());
+    destinationRect.intersect(backendRect());
+
+    update(destinationRect);
 }
 
 size_t ImageBufferJavaBackend::calculateMemoryCost(const Parameters& parameters)
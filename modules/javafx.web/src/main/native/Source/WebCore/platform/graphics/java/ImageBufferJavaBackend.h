@@ -47,7 +47,7 @@ public:
     JLObject getWCImage() const;
     Vector<uint8_t> toDataJava(const String& mimeType, std::optional<double>) override;
     void* getData() const;
-    void update() const;
+    void update(const IntRect&) const;
 
     GraphicsContext& context() const override;
     void flushContext() override;
@@ -74,6 +74,12 @@ protected:
     PlatformImagePtr m_image;
     std::unique_ptr<GraphicsContext> m_context;
     IntSize m_backendSize;
+
+    // The pixel buffer of the Java image stays mapped between calls, and is
+    // read back again only if something was drawn since the last read.
+    mutable JGObject m_pixelBuffer;
+    mutable void* m_data { nullptr };
+    mutable unsigned m_dataFlushCount { 0 };
 };
 
 } // namespace WebCore
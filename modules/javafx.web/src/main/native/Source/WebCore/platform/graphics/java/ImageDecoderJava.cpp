@@ -107,17 +107,18 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
     static jmethodID midAddImageData = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "addImageData",
-        "([B)V");
+        "(Ljava/nio/ByteBuffer;)V");
     ASSERT(midAddImageData);
 
     while (m_receivedDataSize < data.size()) {
         const auto& someData = data.getSomeData(m_receivedDataSize);
         unsigned length = someData.size();
-        JLByteArray jArray(env->NewByteArray(length));
-        if (jArray && !WTF::CheckAndClearException(env)) {
-            // not OOME in Java
-            env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
+        // The direct buffer wraps the segment of the shared buffer, which
+        // outlives the call; the decoder copies the bytes before returning.
+        JLObject byteBuffer(env->NewDirectByteBuffer(
+            const_cast<uint8_t*>(someData.data()), length));
+        if (byteBuffer && !WTF::CheckAndClearException(env)) {
+            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jobject)byteBuffer);
             WTF::CheckAndClearException(env);
         }
         m_receivedDataSize += length;
@@ -176,9 +177,15 @@ size_t ImageDecoderJava::frameCount() const
         : count;
 }
 
-PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions&)
+PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions& decodingOptions)
 {
     JNIEnv* env = WTF::GetJavaEnv();
+    if (!env && decodingOptions.decodingMode() == DecodingMode::Asynchronous) {
+        // Asynchronous decoding runs on the work queue of the ImageSource,
+        // the thread stays attached until it exits.
+        static thread_local WTF::AttachThreadAsDaemonToJavaEnv autoAttach;
+        env = autoAttach.env();
+    }
     if (!env || !m_nativeDecoder) {
         return { };
     }
@@ -217,6 +224,23 @@ PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, Subsampli
     return ImageJava::create(RQRef::create(frame), nullptr, frameSize.width(), frameSize.height());
 }
 
+void ImageDecoderJava::clearFrameBufferCache(size_t)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env || !m_nativeDecoder) {
+        return;
+    }
+
+    static jmethodID midDestroyDecodedFrames = env->GetMethodID(
+        PG_GetGraphicsImageDecoderClass(env),
+        "destroyDecodedFrames",
+        "()V");
+    ASSERT(midDestroyDecodedFrames);
+
+    env->CallVoidMethod(m_nativeDecoder, midDestroyDecodedFrames);
+    WTF::CheckAndClearException(env);
+}
+
 WTF::Seconds ImageDecoderJava::frameDurationAtIndex(size_t idx) const
 {
     JNIEnv* env = WTF::GetJavaEnv();
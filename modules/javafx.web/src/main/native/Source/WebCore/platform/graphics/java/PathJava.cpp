@@ -95,6 +95,10 @@ Path::Path(const Path& p)
     : m_path(copyPath(p.platformPath()))
 {}
 
+Path::Path(RefPtr<RQRef>&& path)
+    : m_path(path ? WTFMove(path) : createEmptyPath())
+{}
+
 Path::~Path()
 {}
 
@@ -102,12 +106,16 @@ Path::Path(Path&& other)
 {
     m_path = other.m_path;
     other.m_path = nullptr;
+    m_pendingSegmentTypes = WTFMove(other.m_pendingSegmentTypes);
+    m_pendingSegmentCoords = WTFMove(other.m_pendingSegmentCoords);
 }
 
 Path& Path::operator=(const Path &p)
 {
     if (this != &p) {
         m_path = copyPath(p.platformPath());
+        m_pendingSegmentTypes.clear();
+        m_pendingSegmentCoords.clear();
     }
     return *this;
 }
@@ -119,12 +127,59 @@ Path& Path::operator=(Path&& other)
 
     m_path = other.m_path;
     other.m_path = nullptr;
+    m_pendingSegmentTypes = WTFMove(other.m_pendingSegmentTypes);
+    m_pendingSegmentCoords = WTFMove(other.m_pendingSegmentCoords);
     return *this;
 }
 
+PlatformPathPtr Path::platformPath() const
+{
+    flushPendingSegments();
+    return m_path;
+}
+
+void Path::appendPendingSegment(jint type, std::initializer_list<FloatPoint> points)
+{
+    ASSERT(m_path);
+
+    m_pendingSegmentTypes.append(type);
+    for (auto& point : points) {
+        m_pendingSegmentCoords.append(point.x());
+        m_pendingSegmentCoords.append(point.y());
+    }
+}
+
+void Path::flushPendingSegments() const
+{
+    if (m_pendingSegmentTypes.isEmpty() || !m_path)
+        return;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addSegments",
+        "([I[F)V");
+    ASSERT(mid);
+
+    JLocalRef<jintArray> types(env->NewIntArray(m_pendingSegmentTypes.size()));
+    JLocalRef<jfloatArray> coords(env->NewFloatArray(m_pendingSegmentCoords.size()));
+    if (!types || !coords) {
+        WTF::CheckAndClearException(env);
+        return;
+    }
+    env->SetIntArrayRegion(types, 0, m_pendingSegmentTypes.size(), m_pendingSegmentTypes.data());
+    env->SetFloatArrayRegion(coords, 0, m_pendingSegmentCoords.size(), m_pendingSegmentCoords.data());
+
+    env->CallVoidMethod(*m_path, mid, (jintArray)types, (jfloatArray)coords);
+    WTF::CheckAndClearException(env);
+
+    m_pendingSegmentTypes.clear();
+    m_pendingSegmentCoords.clear();
+}
+
 bool Path::contains(const FloatPoint& p, WindRule rule) const
 {
     ASSERT(m_path);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -152,6 +207,7 @@ FloatRect Path::fastBoundingRectSlowCase() const
 FloatRect Path::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
     ASSERT(m_path);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -197,6 +253,9 @@ void Path::clear()
 {
     ASSERT(m_path);
 
+    m_pendingSegmentTypes.clear();
+    m_pendingSegmentCoords.clear();
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
@@ -211,6 +270,11 @@ bool Path::isEmptySlowCase() const
 {
     ASSERT(m_path);
 
+    // Any pending segment other than a close sets the current point.
+    if (!m_pendingSegmentCoords.isEmpty())
+        return false;
+    flushPendingSegments();
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
@@ -232,68 +296,31 @@ FloatPoint Path::currentPointSlowCase() const
 
 void Path::moveToSlowCase(const FloatPoint &p)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO, { p });
 }
 
 void Path::addLineToSlowCase(const FloatPoint &p)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_LINETO, { p });
 }
 
 void Path::addQuadCurveToSlowCase(const FloatPoint &cp, const FloatPoint &p)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid, (jdouble)cp.x(), (jdouble)cp.y(), (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO, { cp, p });
 }
 
 void Path::addBezierCurveToSlowCase(const FloatPoint & controlPoint1,
                             const FloatPoint & controlPoint2,
                             const FloatPoint & controlPoint3)
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid,
-                        (jdouble)controlPoint1.x(), (jdouble)controlPoint1.y(),
-                        (jdouble)controlPoint2.x(), (jdouble)controlPoint2.y(),
-                        (jdouble)controlPoint3.x(), (jdouble)controlPoint3.y());
-    WTF::CheckAndClearException(env);
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO,
+        { controlPoint1, controlPoint2, controlPoint3 });
 }
 
 void Path::addArcTo(const FloatPoint & p1, const FloatPoint & p2, float radius)
 {
     ASSERT(m_path);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -309,22 +336,14 @@ void Path::addArcTo(const FloatPoint & p1, const FloatPoint & p2, float radius)
 
 void Path::closeSubpath()
 {
-    ASSERT(m_path);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_path, mid);
-    WTF::CheckAndClearException(env);
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE, { });
 }
 
 void Path::addArcSlowCase(const FloatPoint & p, float radius, float startAngle,
                   float endAngle, bool clockwise)
 {
     ASSERT(m_path);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -341,6 +360,7 @@ void Path::addArcSlowCase(const FloatPoint & p, float radius, float startAngle,
 void Path::addRect(const FloatRect& r)
 {
     ASSERT(m_path);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -366,6 +386,7 @@ void Path::addPath(const Path&, const AffineTransform&)
 void Path::addEllipse(const FloatRect& r)
 {
     ASSERT(m_path);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
@@ -381,6 +402,7 @@ void Path::addEllipse(const FloatRect& r)
 void Path::translate(const FloatSize &sz)
 {
     ASSERT(m_path);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "translate",
@@ -395,6 +417,7 @@ void Path::translate(const FloatSize &sz)
 void Path::transform(const AffineTransform &at)
 {
     ASSERT(m_path);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -412,6 +435,7 @@ void Path::transform(const AffineTransform &at)
 void Path::applySlowCase(const PathApplierFunction& function) const
 {
     ASSERT(m_path);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -483,6 +507,7 @@ void Path::applySlowCase(const PathApplierFunction& function) const
 bool Path::strokeContains(const FloatPoint& p, const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
     ASSERT(m_path);
+    flushPendingSegments();
     ASSERT(strokeStyleApplier);
 
     GraphicsContext& gc = scratchContext();
@@ -29,8 +29,11 @@
 #include "Path.h"
 #include "RenderingQueue.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
+#include <array>
 #include <jni.h>
+#include <optional>
 #include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
@@ -39,6 +42,24 @@ namespace WebCore {
     class PlatformContextJava {
         WTF_MAKE_NONCOPYABLE(PlatformContextJava);
     public:
+        // The last state values encoded to the java graphics context. A state
+        // command is only encoded when its value differs from the one kept
+        // here; an empty value means the java side state is not known.
+        struct StateShadow {
+            std::optional<std::array<float, 4>> fillColor;
+            std::optional<std::array<float, 4>> strokeColor;
+            std::optional<jint> strokeStyle;
+            std::optional<float> strokeThickness;
+            std::optional<jint> textMode;
+            std::optional<std::array<float, 7>> shadow;
+            std::optional<jint> compositeOperation;
+            std::optional<float> alpha;
+            std::optional<jint> lineCap;
+            std::optional<jint> lineJoin;
+            std::optional<float> miterLimit;
+            std::optional<std::pair<float, DashArray>> lineDash;
+        };
+
         PlatformContextJava(const JLObject& jRQ, RefPtr<RQRef> jTheme, bool autoFlush = false)
             : m_rq(RenderingQueue::create(jRQ, com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / RenderingQueue::MAX_BUFFER_COUNT, autoFlush))
             , m_jRenderTheme(jTheme)
@@ -119,6 +140,22 @@ namespace WebCore {
         void setMiterLimit(float miterLimit) {
             m_miterLimit = miterLimit;
         }
+
+        StateShadow& stateShadow() {
+            return m_stateShadow;
+        }
+
+        // Mirrors the state stack of the java graphics context: SAVESTATE and
+        // BEGINTRANSPARENCYLAYER push, RESTORESTATE and ENDTRANSPARENCYLAYER pop.
+        void saveStateShadow() {
+            m_stateShadowStack.append(m_stateShadow);
+        }
+
+        void restoreStateShadow() {
+            m_stateShadow = m_stateShadowStack.isEmpty()
+                ? StateShadow { }
+                : m_stateShadowStack.takeLast();
+        }
     private:
         RefPtr<RenderingQueue> m_rq;
         RefPtr<RQRef> m_jRenderTheme;
@@ -130,5 +167,7 @@ namespace WebCore {
         LineCap m_lineCap { };
         LineJoin m_lineJoin { };
         float m_miterLimit { };
+        StateShadow m_stateShadow;
+        Vector<StateShadow> m_stateShadowStack;
     };
 }
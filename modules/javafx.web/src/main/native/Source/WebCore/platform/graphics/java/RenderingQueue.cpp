@@ -30,19 +30,90 @@
 #include "RQRef.h"
 
 #include <wtf/java/JavaRef.h>
-#include <wtf/HashMap.h>
 #include <wtf/NeverDestroyed.h>
+#include <wtf/Vector.h>
 
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
 
 namespace WebCore {
 
-typedef HashMap<char*, RefPtr<ByteBuffer> > Addr2ByteBuffer;
+/*
+ * Buffers handed over to Java are kept alive in the registry until
+ * WCRenderQueue releases them by index. Released buffers of the default
+ * capacity are reset and kept in a small pool instead of being freed, so
+ * painting a frame doesn't allocate new command buffers every time.
+ *
+ * Everything here is accessed on the Event thread only, see flushBuffer
+ * and twkRelease, so no locking is needed.
+ */
+static const int POOLED_BUFFER_CAPACITY =
+    com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / RenderingQueue::MAX_BUFFER_COUNT;
+
+typedef Vector<RefPtr<ByteBuffer> > ByteBufferList;
+
+static ByteBufferList& getRegistry()
+{
+    static NeverDestroyed<ByteBufferList> registry;
+    return registry.get();
+}
+
+static Vector<int>& getFreeRegistryIndices()
+{
+    static NeverDestroyed<Vector<int> > indices;
+    return indices.get();
+}
+
+static ByteBufferList& getBufferPool()
+{
+    static NeverDestroyed<ByteBufferList> pool;
+    return pool.get();
+}
+
+static int registerBuffer(RefPtr<ByteBuffer> buffer)
+{
+    ByteBufferList& registry = getRegistry();
+    Vector<int>& freeIndices = getFreeRegistryIndices();
+
+    int index;
+    if (freeIndices.isEmpty()) {
+        index = registry.size();
+        registry.append(buffer);
+    } else {
+        index = freeIndices.takeLast();
+        registry[index] = buffer;
+    }
+    buffer->setRegistryIndex(index);
+    return index;
+}
+
+static void releaseBuffer(int index)
+{
+    ByteBufferList& registry = getRegistry();
+    if (index < 0 || (size_t)index >= registry.size() || !registry[index]) {
+        return;
+    }
+
+    RefPtr<ByteBuffer> buffer = WTFMove(registry[index]);
+    getFreeRegistryIndices().append(index);
 
-static Addr2ByteBuffer& getAddr2ByteBuffer()
+    ByteBufferList& pool = getBufferPool();
+    if (buffer->capacity() == POOLED_BUFFER_CAPACITY
+        && buffer->hasOneRef()
+        && pool.size() < RenderingQueue::MAX_POOLED_BUFFER_COUNT) {
+        // Drops the RQRef list too, which must happen on the Event thread.
+        buffer->reset();
+        pool.append(WTFMove(buffer));
+    }
+}
+
+/*static*/
+RefPtr<ByteBuffer> RenderingQueue::acquireBuffer(int capacity)
 {
-    static NeverDestroyed<Addr2ByteBuffer> container;
-    return container.get();
+    ByteBufferList& pool = getBufferPool();
+    if (capacity == POOLED_BUFFER_CAPACITY && !pool.isEmpty()) {
+        return pool.takeLast();
+    }
+    return ByteBuffer::create(capacity);
 }
 
 /*static*/
@@ -65,7 +136,7 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
         }
     }
     if (!m_buffer) {
-        m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        m_buffer = acquireBuffer(std::max(m_capacity, size));
     }
     return *this;
 }
@@ -106,18 +177,19 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
-        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
+        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;I)V");
     ASSERT(midFwkAddBuffer);
 
-    Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
-    a2bb.set(m_buffer->bufferAddress(), m_buffer);
+    int index = registerBuffer(m_buffer);
     env->CallVoidMethod(
         getWCRenderingQueue(),
         midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
+        (jobject)(m_buffer->createDirectByteBuffer(env)),
+        (jint)index);
     WTF::CheckAndClearException(env);
 
     m_buffer = nullptr;
+    m_flushCount++;
 
     return *this;
 }
@@ -125,7 +197,7 @@ RenderingQueue& RenderingQueue::flushBuffer() {
 
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
-    (JNIEnv* env, jobject, jobjectArray bufs)
+    (JNIEnv* env, jobject, jintArray ids)
 {
     using namespace WebCore;
     /*
@@ -134,12 +206,13 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
      * so when a resource is dereferenced (as a result of ByteBuffer destruction)
      * it should be thread safe.
      */
-    Addr2ByteBuffer& a2bb = getAddr2ByteBuffer();
-    for (int i = 0; i < env->GetArrayLength(bufs); ++i) {
-        char *key = (char *)env->GetDirectBufferAddress(
-            JLObject(env->GetObjectArrayElement(bufs, i)));
-        if (key != 0) {
-            a2bb.remove(key);
-        }
+    jsize count = env->GetArrayLength(ids);
+    if (count <= 0) {
+        return;
+    }
+    Vector<jint> indices(count);
+    env->GetIntArrayRegion(ids, 0, count, indices.data());
+    for (jint index : indices) {
+        releaseBuffer(index);
     }
 }
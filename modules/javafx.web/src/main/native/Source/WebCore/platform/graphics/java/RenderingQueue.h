@@ -53,6 +53,20 @@ public:
 
     char* bufferAddress() { return m_buffer; }
 
+    int capacity() const { return m_capacity; }
+
+    int registryIndex() const { return m_registryIndex; }
+    void setRegistryIndex(int index) { m_registryIndex = index; }
+
+    // Makes a buffer released by Java ready for reuse. Must be called on
+    // the Event thread, see twkRelease.
+    void reset() {
+        m_position = 0;
+        m_registryIndex = -1;
+        m_nio_holder.clear();
+        m_refList.clear();
+    }
+
     void putRef(RefPtr<RQRef> ref) {
         ASSERT(m_position + sizeof(jint) <= m_capacity);
         RefPtr<RQRef> repeatable_use_holder(ref);
@@ -84,12 +98,14 @@ private:
     ByteBuffer(int capacity) :
         m_buffer(new char[capacity]),
         m_capacity(capacity),
-        m_position(0)
+        m_position(0),
+        m_registryIndex(-1)
     {}
 
     char* m_buffer;
     int m_capacity;
     int m_position;
+    int m_registryIndex; // slot in the buffer registry while owned by Java
     JGObject m_nio_holder;
     Vector< RefPtr<RQRef> > m_refList;
 };
@@ -108,6 +124,7 @@ class RenderingQueue : public RefCounted<RenderingQueue> {
     RQ_LOG_INSTANCE_COUNT(RenderingQueue)
 public:
     static const size_t MAX_BUFFER_COUNT = 8;
+    static const size_t MAX_POOLED_BUFFER_COUNT = 4 * MAX_BUFFER_COUNT;
 
     static RefPtr<RenderingQueue> create(
         const JLObject &jRQ,
@@ -138,6 +155,10 @@ public:
         return m_buffer == nullptr || m_buffer->isEmpty();
     }
 
+    // Number of buffers handed over to Java so far. Lets the owner of an
+    // image tell whether anything was drawn since it last read the pixels.
+    unsigned flushCount() const { return m_flushCount; }
+
     JLObject getWCRenderingQueue() {
         return m_rqoRenderingQueue->cloneLocalCopy();
     }
@@ -157,12 +178,15 @@ private:
         m_rqoRenderingQueue(RQRef::create(jRQ)),
         m_capacity(capacity),
         m_autoFlush(autoFlush),
-        m_buffer(nullptr)
+        m_buffer(nullptr),
+        m_flushCount(0)
     {}
 
     void flush();
     void disposeGraphics();
 
+    static RefPtr<ByteBuffer> acquireBuffer(int capacity);
+
     //we need to have RQRef here due to [deref]
     //callback in destructor. Texture need to be released.
     RefPtr<RQRef> m_rqoRenderingQueue;
@@ -170,6 +194,7 @@ private:
     int m_capacity;
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
+    unsigned m_flushCount;
 
 };
 } // namespace WebCore
@@ -32,9 +32,11 @@
 #include "CSSPropertyNames.h"
 #include "CSSFontSelector.h"
 #include "CSSValueKeywords.h"
+#include "Document.h"
 #include "PlatformJavaClasses.h"
 #include "HTMLInputElement.h"
 #include "HTMLMediaElement.h"
+#include "Logging.h"
 #include "NotImplemented.h"
 #include "PaintInfo.h"
 #include "PlatformContextJava.h"
@@ -71,6 +73,47 @@ RenderThemeJava::RenderThemeJava()
 {
 }
 
+// Skins of these widgets depend only on the parameters passed to the Java
+// theme, so a rendered bitmap can be reused for every control that matches.
+// Progress bars and meters animate in the Java theme and are always drawn.
+static bool isWidgetSkinCacheable(int widgetIndex)
+{
+    switch (widgetIndex) {
+    case JNI_EXPAND(TEXT_FIELD):
+    case JNI_EXPAND(BUTTON):
+    case JNI_EXPAND(CHECK_BOX):
+    case JNI_EXPAND(RADIO_BUTTON):
+    case JNI_EXPAND(MENU_LIST):
+    case JNI_EXPAND(MENU_LIST_BUTTON):
+    case JNI_EXPAND(SLIDER):
+        return true;
+    default:
+        return false;
+    }
+}
+
+static const unsigned widgetSkinCacheCapacity = 128;
+static const float maxCachedWidgetSkinArea = 256 * 256;
+
+void RenderThemeJava::clearWidgetSkinCache()
+{
+    LOG(PerformanceLogging, "RenderThemeJava widget skin cache: %u entries, %u hits, %u misses",
+        m_widgetSkinCache.size(), m_widgetSkinCacheHits, m_widgetSkinCacheMisses);
+    m_widgetSkinCache.clear();
+}
+
+void RenderThemeJava::purgeCaches()
+{
+    clearWidgetSkinCache();
+    RenderTheme::purgeCaches();
+}
+
+void RenderThemeJava::platformColorsDidChange()
+{
+    clearWidgetSkinCache();
+    RenderTheme::platformColorsDidChange();
+}
+
 int RenderThemeJava::createWidgetState(const RenderObject& o)
 {
     int state = 0;
@@ -185,18 +228,45 @@ bool RenderThemeJava::paintWidget(
         memcpy(data, &region, sizeof(region));
     }
 
+    auto [r, g, b, a] = bgColor.toColorTypeLossy<SRGBA<uint8_t>>().resolved();
+    jint argb = a << 24 | r << 16 | g << 8 | b;
+
+    Vector<jint> skinKey;
+    RefPtr<ImageBuffer> skin;
+    float scale = object.document().deviceScaleFactor()
+        * std::max(paintInfo.context().scaleFactor().width(), paintInfo.context().scaleFactor().height());
+    if (isWidgetSkinCacheable(widgetIndex) && !rect.isEmpty()
+        && rect.width() * rect.height() * scale * scale <= maxCachedWidgetSkinArea) {
+        skinKey = {
+            (jint)*jRenderTheme, (jint)widgetIndex, (jint)state,
+            (jint)rect.width(), (jint)rect.height(), argb, bitwise_cast<jint>(scale)
+        };
+        for (size_t i = 0; i + sizeof(jint) <= extParams.size(); i += sizeof(jint)) {
+            jint param;
+            memcpy(&param, extParams.data() + i, sizeof(param));
+            skinKey.append(param);
+        }
+
+        if (auto cachedSkin = m_widgetSkinCache.get(skinKey)) {
+            ++m_widgetSkinCacheHits;
+            paintInfo.context().drawImageBuffer(*cachedSkin, rect.location());
+            return false;
+        }
+        ++m_widgetSkinCacheMisses;
+        skin = ImageBuffer::create(rect.size(), RenderingPurpose::Unspecified, scale, DestinationColorSpace::SRGB(), PixelFormat::BGRA8);
+    }
+
     static jmethodID mid = env->GetMethodID(PG_GetRenderThemeClass(env), "createWidget",
             "(JIIIIILjava/nio/ByteBuffer;)Lcom/sun/webkit/graphics/Ref;");
     ASSERT(mid);
 
-    auto [r, g, b, a] = bgColor.toColorTypeLossy<SRGBA<uint8_t>>().resolved();
     RefPtr<RQRef> widgetRef = RQRef::create(
         env->CallObjectMethod(jobject(*jRenderTheme), mid,
             ptr_to_jlong(&object),
             (jint)widgetIndex,
             (jint)state,
             (jint)rect.width(), (jint)rect.height(),
-            (jint)(a << 24 | r << 16 | g << 8 | b),
+            argb,
             (jobject)JLObject(extParams.isEmpty()
                 ? nullptr
                 : env->NewDirectByteBuffer(
@@ -209,12 +279,31 @@ bool RenderThemeJava::paintWidget(
     }
     WTF::CheckAndClearException(env);
 
-    // widgetRef will go into rq's inner refs vector.
-    paintInfo.context().platformContext()->rq().freeSpace(20)
+    if (!skin) {
+        // widgetRef will go into rq's inner refs vector.
+        paintInfo.context().platformContext()->rq().freeSpace(20)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWWIDGET
+        << (jint)*jRenderTheme
+        << widgetRef
+        << (jint)rect.x() << (jint)rect.y();
+        return false;
+    }
+
+    // Render the skin once into its own buffer and draw that, later paints
+    // with the same key draw the buffer without calling into the Java theme.
+    // The buffer has scale times as many pixels as rect, and drawImageBuffer
+    // maps it back to rect, so the widget must be drawn scaled up.
+    skin->context().scale(scale);
+    skin->context().platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWWIDGET
     << (jint)*jRenderTheme
     << widgetRef
-    << (jint)rect.x() << (jint)rect.y();
+    << (jint)0 << (jint)0;
+    paintInfo.context().drawImageBuffer(*skin, rect.location());
+
+    if (m_widgetSkinCache.size() >= widgetSkinCacheCapacity)
+        m_widgetSkinCache.remove(m_widgetSkinCache.random());
+    m_widgetSkinCache.add(WTFMove(skinKey), WTFMove(skin));
 
     return false;
 }
@@ -27,9 +27,12 @@
 
 #include "RenderTheme.h"
 #include "GraphicsContext.h"
+#include "ImageBuffer.h"
 #include "StyleResolver.h"
 
 #include <jni.h>
+#include <wtf/HashMap.h>
+#include <wtf/VectorHash.h>
 
 namespace WebCore {
 
@@ -47,7 +50,11 @@ public:
     // A method asking if the theme's controls actually care about redrawing when hovered.
     bool supportsHover(const RenderStyle&) const override { return true; }
 
+    void purgeCaches() override;
+
 protected:
+    void platformColorsDidChange() override;
+
     bool paintCheckbox(const RenderObject& o, const PaintInfo& i, const FloatRect& r) override;
     void setCheckboxSize(RenderStyle& style) const override;
 
@@ -119,6 +126,13 @@ private:
 #if ENABLE(VIDEO)
     bool paintMediaControl(jint type, const RenderObject&, const PaintInfo&, const IntRect&);
 #endif
+    void clearWidgetSkinCache();
+
+    // Skins rendered by the Java theme, keyed by the theme reference, widget
+    // index, state, size, background color, scale and extra parameters.
+    HashMap<Vector<jint>, RefPtr<ImageBuffer>> m_widgetSkinCache;
+    unsigned m_widgetSkinCacheHits { 0 };
+    unsigned m_widgetSkinCacheMisses { 0 };
 };
 
 } // namespace WebCore
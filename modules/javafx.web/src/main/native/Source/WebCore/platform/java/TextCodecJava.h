@@ -31,6 +31,10 @@
 
 namespace WebCore {
 
+// Decodes and encodes text through java.nio.charset. Only registered when
+// the port is built with USE(JAVA_UNICODE); the default ICU build handles
+// the legacy encodings natively with PAL's TextCodecCJK, TextCodecSingleByte
+// and TextCodecICU, which keep their streaming state across chunks.
 class TextCodecJava : public TextCodec {
 public:
     static void registerEncodingNames(EncodingNameRegistrar);
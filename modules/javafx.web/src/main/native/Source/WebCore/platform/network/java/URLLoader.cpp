@@ -29,6 +29,8 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
 
+#include "BlobData.h"
+#include "FormData.h"
 #include "FrameNetworkingContext.h"
 #include "HTTPParsers.h"
 #include "MIMETypeRegistry.h"
@@ -104,7 +106,7 @@ static void initRefs(JNIEnv* env)
         createFromFileMethod = env->GetStaticMethodID(
                 formDataElementClass,
                 "fwkCreateFromFile",
-                "(Ljava/lang/String;)"
+                "(Ljava/lang/String;JJ)"
                 "Lcom/sun/webkit/network/FormDataElement;");
         ASSERT(createFromFileMethod);
     }
@@ -208,14 +210,18 @@ JLObject URLLoader::load(bool asynchronous,
     return loader;
 }
 
-JLObjectArray URLLoader::toJava(const FormData* formData)
+JLObjectArray URLLoader::toJava(FormData* formData)
 {
     using namespace URLLoaderJavaInternal;
     if (!formData) {
         return nullptr;
     }
 
-    const Vector<FormDataElement>& elements = formData->elements();
+    // Blobs are flattened into byte and file range elements, so that
+    // file backed content is streamed by the loader instead of being
+    // copied into Java arrays.
+    Ref<FormData> resolvedFormData = formData->resolveBlobReferences();
+    const Vector<FormDataElement>& elements = resolvedFormData->elements();
     size_t size = elements.size();
     if (size == 0) {
         return nullptr;
@@ -247,13 +253,17 @@ JLObjectArray URLLoader::toJava(const FormData* formData)
                 resultElement = env->CallStaticObjectMethod(
                         formDataElementClass,
                         createFromFileMethod,
-                        (jstring) data.filename.toJavaString(env));
+                        (jstring) data.filename.toJavaString(env),
+                        (jlong) data.fileStart,
+                        (jlong) data.fileLength);
             },
             [&] (const FormDataElement::EncodedBlobData& data) -> void {
                 resultElement = env->CallStaticObjectMethod(
                         formDataElementClass,
                         createFromFileMethod,
-                        (jstring) data.url.string().toJavaString(env));
+                        (jstring) data.url.string().toJavaString(env),
+                        (jlong) 0,
+                        (jlong) BlobDataItem::toEndOfFile);
             }
         );
         env->SetObjectArrayElement(
@@ -299,11 +309,11 @@ void URLLoader::AsynchronousTarget::didReceiveResponse(
     }
 }
 
-void URLLoader::AsynchronousTarget::didReceiveData(const SharedBuffer* data, int length)
+void URLLoader::AsynchronousTarget::didReceiveData(const SharedBuffer& data, int length)
 {
     ResourceHandleClient* client = m_handle->client();
     if (client) {
-        client->didReceiveData(m_handle, *data, length);
+        client->didReceiveData(m_handle, data, length);
     }
 }
 
@@ -363,9 +373,9 @@ void URLLoader::SynchronousTarget::didReceiveResponse(
     m_response = response;
 }
 
-void URLLoader::SynchronousTarget::didReceiveData(const SharedBuffer* data, int length)
+void URLLoader::SynchronousTarget::didReceiveData(const SharedBuffer& data, int length)
 {
-    m_data.append(*data->data());
+    m_data.append(data.data(), data.size());
 }
 
 void URLLoader::SynchronousTarget::didFinishLoading()
@@ -508,9 +518,11 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDa
     ASSERT(target);
     const uint8_t* address =
             static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<FragmentedSharedBuffer> tmp_buf = FragmentedSharedBuffer::create(address,remaining);
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+    // The byte buffer is recycled by the Java loader once this call returns,
+    // so its content is copied exactly once into a segment that WebCore
+    // then shares by reference.
+    Ref<SharedBuffer> buffer = SharedBuffer::create(address + position, remaining);
+    target->didReceiveData(buffer.get(), remaining);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
@@ -37,6 +37,7 @@ class ResourceError;
 class ResourceHandle;
 class ResourceRequest;
 class ResourceResponse;
+class SharedBuffer;
 
 class URLLoader {
 public:
@@ -57,7 +58,7 @@ public:
                                  long totalBytesToBeSent) = 0;
         virtual bool willSendRequest(const ResourceResponse& response) = 0;
         virtual void didReceiveResponse(const ResourceResponse& response) = 0;
-        virtual void didReceiveData(const SharedBuffer* data, int length) = 0;
+        virtual void didReceiveData(const SharedBuffer& data, int length) = 0;
         virtual void didFinishLoading() = 0;
         virtual void didFail(const ResourceError& error) = 0;
         virtual ~Target();
@@ -70,7 +71,7 @@ private:
                          NetworkingContext* context,
                          const ResourceRequest& request,
                          Target* target);
-    static JLObjectArray toJava(const FormData* formData);
+    static JLObjectArray toJava(FormData* formData);
 
     class AsynchronousTarget : public Target {
     public:
@@ -79,7 +80,7 @@ private:
         void didSendData(long totalBytesSent, long totalBytesToBeSent) final;
         bool willSendRequest(const ResourceResponse& response) final;
         void didReceiveResponse(const ResourceResponse& response) final;
-        void didReceiveData(const SharedBuffer* data, int length) final;
+        void didReceiveData(const SharedBuffer& data, int length) final;
         void didFinishLoading() final;
         void didFail(const ResourceError& error) final;
     private:
@@ -96,7 +97,7 @@ private:
         void didSendData(long totalBytesSent, long totalBytesToBeSent) final;
         bool willSendRequest(const ResourceResponse& response) final;
         void didReceiveResponse(const ResourceResponse& response) final;
-        void didReceiveData(const SharedBuffer* data, int length) final;
+        void didReceiveData(const SharedBuffer& data, int length) final;
         void didFinishLoading() final;
         void didFail(const ResourceError& error) final;
     private:
@@ -28,26 +28,171 @@
 #include <wtf/RefPtr.h>
 
 #include <WebCore/AddEventListenerOptions.h>
+#include <WebCore/Attribute.h>
 #include <WebCore/Document.h>
 #include <WebCore/Element.h>
 #include <WebCore/ElementInlines.h>
 #include <WebCore/Event.h>
 #include <WebCore/EventListener.h>
 #include <WebCore/EventTarget.h>
+#include <WebCore/FloatRect.h>
 #include <WebCore/NamedNodeMap.h>
 #include <WebCore/Node.h>
 #include <WebCore/NodeList.h>
 #include <WebCore/JSExecState.h>
 #include <WebCore/SVGTests.h>
+#include <WebCore/Text.h>
 #include <JavaScriptCore/APICast.h>
 
 #include <WebCore/DOMException.h>
 #include "com_sun_webkit_dom_JSObject.h"
+#include "com_sun_webkit_dom_NodeImpl.h"
 #include <WebCore/JavaDOMUtils.h>
 #include <wtf/java/JavaEnv.h>
 
 using namespace WebCore;
 
+namespace {
+
+// Writes the buffer returned by NodeImpl.serializeSubtree, whose layout
+// is documented there.
+class SubtreeSerializer {
+public:
+    SubtreeSerializer(JNIEnv* env, const String& selectors, jint flags)
+        : m_env(env)
+        , m_selectors(selectors)
+        , m_flags(flags)
+    {
+        appendInt(0);
+    }
+
+    // Walks the subtree in document order with an explicit stack, so that
+    // deeply nested markup cannot exhaust the native stack.
+    bool serialize(Node& root, bool writeText)
+    {
+        struct PendingNode {
+            RefPtr<Node> node;
+            int parent;
+            bool writeText;
+        };
+        Vector<PendingNode> stack;
+        stack.append({ &root, -1, writeText });
+
+        while (!stack.isEmpty()) {
+            auto pending = stack.takeLast();
+            Node& node = *pending.node;
+            int parent = pending.parent;
+            bool writeChildText = pending.writeText;
+
+            if (is<Element>(node)) {
+                auto& element = downcast<Element>(node);
+                bool matches = true;
+                if (!m_selectors.isNull()) {
+                    auto result = element.matches(m_selectors);
+                    if (result.hasException()) {
+                        raiseDOMErrorException(m_env, result.releaseException());
+                        return false;
+                    }
+                    matches = result.releaseReturnValue();
+                }
+                if (matches) {
+                    writeElement(element, parent);
+                    parent = m_recordCount - 1;
+                }
+                writeChildText = matches;
+            } else if (is<Text>(node)) {
+                if (pending.writeText) {
+                    appendRecordHeader(node, parent);
+                    appendString(downcast<Text>(node).data());
+                }
+                continue;
+            }
+
+            // Pushed last to first so that the first child is popped next.
+            for (RefPtr child = node.lastChild(); child; child = child->previousSibling())
+                stack.append({ child, parent, writeChildText });
+        }
+        return true;
+    }
+
+    jbyteArray toJavaArray()
+    {
+        for (unsigned i = 0; i < 4; ++i)
+            m_buffer[i] = m_recordCount >> (24 - 8 * i);
+
+        jbyteArray result = m_env->NewByteArray(m_buffer.size());
+        if (!result)
+            return nullptr;
+        m_env->SetByteArrayRegion(result, 0, m_buffer.size(), reinterpret_cast<const jbyte*>(m_buffer.data()));
+        return result;
+    }
+
+private:
+    void writeElement(Element& element, int parent)
+    {
+        appendRecordHeader(element, parent);
+        appendString(element.tagName());
+        if (!element.hasAttributes()) {
+            appendInt(0);
+        } else {
+            appendInt(element.attributeCount());
+            for (const Attribute& attribute : element.attributesIterator()) {
+                appendString(attribute.name().toString());
+                appendString(attribute.value());
+            }
+        }
+        if (m_flags & com_sun_webkit_dom_NodeImpl_SERIALIZE_GEOMETRY) {
+            FloatRect rect = element.boundingClientRect();
+            appendFloat(rect.x());
+            appendFloat(rect.y());
+            appendFloat(rect.width());
+            appendFloat(rect.height());
+        }
+    }
+
+    void appendRecordHeader(Node& node, int parent)
+    {
+        ++m_recordCount;
+        uint16_t nodeType = node.nodeType();
+        m_buffer.append(static_cast<uint8_t>(nodeType >> 8));
+        m_buffer.append(static_cast<uint8_t>(nodeType));
+        appendInt(parent);
+    }
+
+    void appendInt(uint32_t value)
+    {
+        m_buffer.append(static_cast<uint8_t>(value >> 24));
+        m_buffer.append(static_cast<uint8_t>(value >> 16));
+        m_buffer.append(static_cast<uint8_t>(value >> 8));
+        m_buffer.append(static_cast<uint8_t>(value));
+    }
+
+    void appendFloat(float value)
+    {
+        appendInt(bitwise_cast<uint32_t>(value));
+    }
+
+    void appendString(const String& string)
+    {
+        unsigned length = string.length();
+        appendInt(length);
+        m_buffer.reserveCapacity(m_buffer.size() + 2 * length);
+        for (unsigned i = 0; i < length; ++i) {
+            UChar c = string[i];
+            m_buffer.uncheckedAppend(static_cast<uint8_t>(c >> 8));
+            m_buffer.uncheckedAppend(static_cast<uint8_t>(c));
+        }
+    }
+
+    JNIEnv* m_env;
+    const String& m_selectors;
+    jint m_flags;
+    Vector<uint8_t> m_buffer;
+    unsigned m_recordCount { 0 };
+};
+
+} // namespace
+
 extern "C" {
 
 #define IMPL (static_cast<Node*>(jlong_to_ptr(peer)))
@@ -354,4 +499,20 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_NodeImpl_dispatchEventImpl(JN
 }
 
 
+JNIEXPORT jbyteArray JNICALL Java_com_sun_webkit_dom_NodeImpl_serializeSubtreeImpl(JNIEnv* env, jclass, jlong peer
+    , jstring selectors
+    , jint flags)
+{
+    WebCore::JSMainThreadNullState state;
+    String selectorString = selectors ? String(env, selectors) : String();
+    if (flags & com_sun_webkit_dom_NodeImpl_SERIALIZE_GEOMETRY)
+        IMPL->document().updateLayoutIgnorePendingStylesheets();
+
+    SubtreeSerializer serializer(env, selectorString, flags);
+    if (!serializer.serialize(*IMPL, selectorString.isNull()))
+        return nullptr;
+    return serializer.toJavaArray();
+}
+
+
 }
@@ -277,6 +277,35 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
     gc.platformContext()->rq().flushBuffer();
 }
 
+// Paints the main frame contents for a rect in document coordinates,
+// without scrollbars and without clipping to the visible area.
+void WebPage::paintTile(jobject rq, jint x, jint y, jint w, jint h)
+{
+    if (m_rootLayer) {
+        return;
+    }
+
+    RefPtr<Frame> mainFrame((Frame*)&m_page->mainFrame());
+    RefPtr<FrameView> frameView(mainFrame->view());
+    // Nothing is recorded when the tile cannot be painted yet
+    if (!frameView || frameView->needsLayout()) {
+        return;
+    }
+
+    // Will be deleted by GraphicsContext destructor
+    PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
+    GraphicsContextJava gc(ppgc);
+
+    JSGlobalContextRef globalContext = toGlobalRef(mainFrame->script().globalObject(mainThreadNormalWorld()));
+    JSC::JSLockHolder sw(toJS(globalContext));
+
+    IntRect rect(x, y, w, h);
+    gc.clip(rect);
+    frameView->paintContents(gc, rect);
+
+    gc.platformContext()->rq().flushBuffer();
+}
+
 void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
 {
     if (!m_page->inspectorController().highlightedNode()
@@ -1662,6 +1691,57 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateContent
     WebPage::webPageFromJLong(pPage)->paint(rq, x, y, w, h);
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateTile
+    (JNIEnv* env, jobject self, jlong pPage, jobject rq, jint x, jint y, jint w, jint h)
+{
+    WebPage::webPageFromJLong(pPage)->paintTile(rq, x, y, w, h);
+}
+
+JNIEXPORT jintArray JNICALL Java_com_sun_webkit_WebPage_twkGetTileState
+    (JNIEnv* env, jobject self, jlong pPage)
+{
+    Page* page = WebPage::pageFromJLong(pPage);
+    FrameView* frameView = page->mainFrame().view();
+    if (!frameView) {
+        return nullptr;
+    }
+
+    // Style, layout and offscreen repaint counters. Content that is not
+    // visible is not invalidated by WebCore, so recorded tiles that are
+    // not visible are kept only as long as this value does not change.
+    jint generation = frameView->offscreenRepaintCount();
+    for (Frame* frame = &page->mainFrame(); frame; frame = frame->tree().traverseNext()) {
+        if (frame->document()) {
+            generation += frame->document()->styleRecalcCount();
+        }
+        if (frame->view()) {
+            generation += frame->view()->layoutContext().layoutCount();
+        }
+    }
+
+    IntPoint scrollPosition = frameView->scrollPosition();
+    IntSize visibleSize = frameView->visibleContentRect().size();
+    IntSize contentsSize = frameView->contentsSize();
+
+    jintArray result = env->NewIntArray(8);
+    if (WTF::CheckAndClearException(env) || !result) {
+        return nullptr;
+    }
+
+    jint* arr = (jint*)env->GetPrimitiveArrayCritical(result, nullptr);
+    arr[0] = scrollPosition.x();
+    arr[1] = scrollPosition.y();
+    arr[2] = visibleSize.width();
+    arr[3] = visibleSize.height();
+    arr[4] = contentsSize.width();
+    arr[5] = contentsSize.height();
+    arr[6] = frameView->hasViewportConstrainedObjects() ? 1 : 0;
+    arr[7] = generation;
+    env->ReleasePrimitiveArrayCritical(result, arr, 0);
+
+    return result;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateRendering
     (JNIEnv*, jobject, jlong pPage)
 {
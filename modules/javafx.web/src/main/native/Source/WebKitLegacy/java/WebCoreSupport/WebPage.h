@@ -83,6 +83,7 @@ public:
     void setSize(const IntSize&);
     void prePaint();
     void paint(jobject, jint, jint, jint, jint);
+    void paintTile(jobject, jint, jint, jint, jint);
     void postPaint(jobject, jint, jint, jint, jint);
     bool processKeyEvent(const PlatformKeyboardEvent& event);
 
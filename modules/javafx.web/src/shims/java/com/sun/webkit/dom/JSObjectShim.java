@@ -26,7 +26,16 @@ package com.sun.webkit.dom;
 
 public class JSObjectShim {
 
+    public static final int BATCH_GET_MEMBER = JSObject.BATCH_GET_MEMBER;
+    public static final int BATCH_SET_MEMBER = JSObject.BATCH_SET_MEMBER;
+    public static final int BATCH_CALL = JSObject.BATCH_CALL;
+
     public static int test_getPeerCount() {
         return JSObject.test_getPeerCount();
     }
+
+    public static Object[] batch(netscape.javascript.JSObject object,
+                                 int[] ops, String[] names, Object[] values) {
+        return ((JSObject) object).batch(ops, names, values);
+    }
 }
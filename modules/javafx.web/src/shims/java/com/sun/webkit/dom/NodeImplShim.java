@@ -25,9 +25,17 @@
 
 package com.sun.webkit.dom;
 
+import org.w3c.dom.Node;
+
 public class NodeImplShim {
 
+    public static final int SERIALIZE_GEOMETRY = NodeImpl.SERIALIZE_GEOMETRY;
+
     public static int test_getHashCount() {
         return NodeImpl.test_getHashCount();
     }
+
+    public static byte[] serializeSubtree(Node node, String selectors, int flags) {
+        return ((NodeImpl) node).serializeSubtree(selectors, flags);
+    }
 }
@@ -157,6 +157,138 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    private static final String PIXEL_TEST_CANVAS = "\n"
+        + "<canvas id='canvas' width='100' height='100'></canvas>\n"
+        + "<script>\n"
+        + "var ctx = document.getElementById('canvas').getContext('2d');\n"
+        + "function px(x, y) {\n"
+        + "    var d = ctx.getImageData(x, y, 1, 1).data;\n"
+        + "    return d[0] + ',' + d[1] + ',' + d[2] + ',' + d[3];\n"
+        + "}\n"
+        + "</script>\n";
+
+    private String pixel(int x, int y) {
+        return (String) executeScript("px(" + x + ", " + y + ")");
+    }
+
+    @Test public void testGetImageDataAfterMoreDrawing() {
+        loadContent(PIXEL_TEST_CANVAS);
+        executeScript("ctx.fillStyle = 'rgb(255, 0, 0)'; ctx.fillRect(0, 0, 50, 50);");
+        assertEquals("255,0,0,255", pixel(10, 10));
+        assertEquals("0,0,0,0", pixel(60, 10));
+
+        // Drawing after a read must not be hidden by the pixels read before.
+        executeScript("ctx.fillStyle = 'rgb(0, 0, 255)'; ctx.fillRect(50, 0, 50, 50);");
+        assertEquals("0,0,255,255", pixel(60, 10));
+        assertEquals("255,0,0,255", pixel(10, 10));
+
+        // Same, with drawing and reads in a single script.
+        assertEquals("0,0,0,0|0,255,0,255", executeScript(
+                "var before = px(10, 60);"
+                + "ctx.fillStyle = 'rgb(0, 255, 0)'; ctx.fillRect(0, 50, 50, 50);"
+                + "before + '|' + px(10, 60)"));
+    }
+
+    @Test public void testPartialPutImageData() {
+        loadContent(PIXEL_TEST_CANVAS);
+        executeScript("ctx.fillStyle = 'rgb(0, 255, 0)'; ctx.fillRect(0, 0, 100, 100);"
+                + "var red = ctx.createImageData(10, 10);"
+                + "for (var i = 0; i < red.data.length; i += 4) {"
+                + "    red.data[i] = 255; red.data[i + 3] = 255;"
+                + "}"
+                + "ctx.putImageData(red, 20, 30);"
+                + "ctx.putImageData(red, 60, 60, 2, 2, 4, 4);");
+
+        final String green = "0,255,0,255";
+        final String red = "255,0,0,255";
+        assertEquals(red, pixel(20, 30));
+        assertEquals(red, pixel(29, 39));
+        assertEquals(green, pixel(19, 35));
+        assertEquals(green, pixel(30, 35));
+        assertEquals(green, pixel(25, 29));
+        assertEquals(green, pixel(25, 40));
+        assertEquals(green, pixel(1, 1));
+        assertEquals(green, pixel(99, 99));
+
+        // Only the 4x4 dirty rect of the second put is written.
+        assertEquals(red, pixel(62, 62));
+        assertEquals(red, pixel(65, 65));
+        assertEquals(green, pixel(61, 62));
+        assertEquals(green, pixel(66, 65));
+        assertEquals(green, pixel(62, 61));
+        assertEquals(green, pixel(65, 66));
+    }
+
+    @Test public void testPutImageDataThenGetImageData() {
+        loadContent(PIXEL_TEST_CANVAS);
+        // Reads before the put populate any cached pixels first.
+        assertEquals(Integer.valueOf(0), executeScript(
+                "ctx.fillStyle = 'rgb(0, 0, 255)'; ctx.fillRect(0, 0, 100, 100);"
+                + "ctx.getImageData(0, 0, 100, 100);"
+                + "var src = ctx.createImageData(40, 30);"
+                + "for (var i = 0; i < src.data.length; i += 4) {"
+                + "    src.data[i] = i % 256;"
+                + "    src.data[i + 1] = (i * 7) % 256;"
+                + "    src.data[i + 2] = (i * 13) % 256;"
+                + "    src.data[i + 3] = 255;"
+                + "}"
+                + "ctx.putImageData(src, 15, 25);"
+                + "var dst = ctx.getImageData(15, 25, 40, 30);"
+                + "var mismatches = 0;"
+                + "for (var i = 0; i < src.data.length; i++) {"
+                + "    if (src.data[i] != dst.data[i]) mismatches++;"
+                + "}"
+                + "mismatches"));
+        assertEquals("0,0,255,255", pixel(14, 25));
+        assertEquals("0,0,255,255", pixel(55, 54));
+    }
+
+    @Test public void testPartialPutImageDataAfterReadThroughTexture() throws Exception {
+        loadContent(PIXEL_TEST_CANVAS);
+        // The full read maps the pixels, the partial put then updates only a
+        // sub rect of the texture. Both are checked below without going back
+        // through getImageData on the same canvas.
+        executeScript("ctx.fillStyle = 'rgb(0, 255, 0)'; ctx.fillRect(0, 0, 100, 100);"
+                + "ctx.getImageData(0, 0, 100, 100);"
+                + "var red = ctx.createImageData(10, 10);"
+                + "for (var i = 0; i < red.data.length; i += 4) {"
+                + "    red.data[i] = 255; red.data[i + 3] = 255;"
+                + "}"
+                + "ctx.putImageData(red, 20, 30);"
+                + "ctx.putImageData(red, 60, 60, 2, 2, 4, 4);"
+                + "var copy = document.createElement('canvas');"
+                + "copy.width = copy.height = 100;"
+                + "var copyCtx = copy.getContext('2d');"
+                + "copyCtx.drawImage(document.getElementById('canvas'), 0, 0);"
+                + "function copyPx(x, y) {"
+                + "    var d = copyCtx.getImageData(x, y, 1, 1).data;"
+                + "    return d[0] + ',' + d[1] + ',' + d[2] + ',' + d[3];"
+                + "}");
+
+        final String green = "0,255,0,255";
+        final String red = "255,0,0,255";
+        assertEquals(red, executeScript("copyPx(20, 30)"));
+        assertEquals(red, executeScript("copyPx(29, 39)"));
+        assertEquals(green, executeScript("copyPx(19, 35)"));
+        assertEquals(green, executeScript("copyPx(30, 35)"));
+        assertEquals(red, executeScript("copyPx(62, 62)"));
+        assertEquals(red, executeScript("copyPx(65, 65)"));
+        assertEquals(green, executeScript("copyPx(61, 62)"));
+        assertEquals(green, executeScript("copyPx(66, 65)"));
+        assertEquals(green, executeScript("copyPx(1, 1)"));
+
+        String img = (String) executeScript(
+                "document.getElementById('canvas').toDataURL('image/png')");
+        assertNotNull(img);
+        final BufferedImage decodedImg = ImageIO.read(new ByteArrayInputStream(
+                Base64.getMimeDecoder().decode(img.split(",")[1])));
+        assertNotNull(decodedImg);
+        assertTrue(isColorsSimilar(Color.RED, new Color(decodedImg.getRGB(25, 35), true), 1));
+        assertTrue(isColorsSimilar(Color.RED, new Color(decodedImg.getRGB(63, 63), true), 1));
+        assertTrue(isColorsSimilar(Color.GREEN, new Color(decodedImg.getRGB(61, 62), true), 1));
+        assertTrue(isColorsSimilar(Color.GREEN, new Color(decodedImg.getRGB(35, 35), true), 1));
+    }
+
     private BufferedImage htmlCanvasToBufferedImage(final String mime) throws Exception {
         ByteArrayOutputStream errStream = new ByteArrayOutputStream();
         System.setErr(new PrintStream(errStream));
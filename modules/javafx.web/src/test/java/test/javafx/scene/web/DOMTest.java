@@ -32,6 +32,11 @@ import static org.junit.Assert.assertSame;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
 
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
 import javafx.scene.web.WebEngine;
 
 import org.junit.Ignore;
@@ -437,6 +442,123 @@ public class DOMTest extends TestBase {
         });
     }
 
+    @Test public void testSerializeSubtree() {
+        loadContent("<body style='margin: 0'>"
+                + "<div id='root' class='box' style='width: 100px; height: 50px'>"
+                + "Hello<span class='x' data-k='v'>World</span><p class='x'>P</p><!--comment-->"
+                + "</div></body>");
+        submit(() -> {
+            final Document doc = getEngine().getDocument();
+            final Element root = doc.getElementById("root");
+
+            List<SerializedNode> nodes = SerializedNode.parse(
+                    NodeImplShim.serializeSubtree(root, null, 0), false);
+            assertEquals("Record count", 6, nodes.size());
+            nodes.get(0).assertElement("DIV", -1);
+            assertEquals("Attributes", Map.of("id", "root", "class", "box",
+                    "style", "width: 100px; height: 50px"), nodes.get(0).attributes);
+            assertNull("No geometry requested", nodes.get(0).rect);
+            nodes.get(1).assertText("Hello", 0);
+            nodes.get(2).assertElement("SPAN", 0);
+            assertEquals("Attributes", Map.of("class", "x", "data-k", "v"), nodes.get(2).attributes);
+            nodes.get(3).assertText("World", 2);
+            nodes.get(4).assertElement("P", 0);
+            nodes.get(5).assertText("P", 4);
+
+            // Only matching elements and their text, linked to the nearest
+            // written ancestor.
+            nodes = SerializedNode.parse(NodeImplShim.serializeSubtree(doc, ".x", 0), false);
+            assertEquals("Record count", 4, nodes.size());
+            nodes.get(0).assertElement("SPAN", -1);
+            nodes.get(1).assertText("World", 0);
+            nodes.get(2).assertElement("P", -1);
+            nodes.get(3).assertText("P", 2);
+
+            nodes = SerializedNode.parse(NodeImplShim.serializeSubtree(
+                    doc, "#root", NodeImplShim.SERIALIZE_GEOMETRY), true);
+            assertEquals("Record count", 2, nodes.size());
+            nodes.get(0).assertElement("DIV", -1);
+            nodes.get(1).assertText("Hello", 0);
+            assertEquals("x", 0, nodes.get(0).rect[0], 0);
+            assertEquals("y", 0, nodes.get(0).rect[1], 0);
+            assertEquals("width", 100, nodes.get(0).rect[2], 0);
+            assertEquals("height", 50, nodes.get(0).rect[3], 0);
+
+            // Nesting far deeper than the HTML parser allows, kept out of
+            // the document so that it is never styled or laid out.
+            final Node detached = (Node) getEngine().executeScript(
+                    "var d = document.createElement('div'), e = d;"
+                    + "for (var i = 0; i < 100000; i++) e = e.appendChild(document.createElement('b'));"
+                    + "d");
+            nodes = SerializedNode.parse(NodeImplShim.serializeSubtree(detached, "b", 0), false);
+            assertEquals("Record count", 100000, nodes.size());
+            assertEquals("Parent of the first element", -1, nodes.get(0).parent);
+            assertEquals("Parent of the deepest element", 99998, nodes.get(99999).parent);
+
+            try {
+                NodeImplShim.serializeSubtree(doc, "[", 0);
+                fail("DOMException expected but not thrown");
+            } catch (DOMException ex) {
+                // Expected.
+            }
+        });
+    }
+
+    // Record of the buffer written by NodeImpl.serializeSubtree.
+    private static final class SerializedNode {
+        short nodeType;
+        int parent;
+        String tagName;
+        Map<String, String> attributes;
+        float[] rect;
+        String data;
+
+        static List<SerializedNode> parse(byte[] bytes, boolean hasGeometry) {
+            final ByteBuffer buffer = ByteBuffer.wrap(bytes);
+            final List<SerializedNode> nodes = new ArrayList<>();
+            for (int count = buffer.getInt(); count > 0; count--) {
+                final SerializedNode node = new SerializedNode();
+                node.nodeType = buffer.getShort();
+                node.parent = buffer.getInt();
+                if (node.nodeType == Node.ELEMENT_NODE) {
+                    node.tagName = getString(buffer);
+                    node.attributes = new LinkedHashMap<>();
+                    for (int n = buffer.getInt(); n > 0; n--) {
+                        node.attributes.put(getString(buffer), getString(buffer));
+                    }
+                    if (hasGeometry) {
+                        node.rect = new float[] {
+                            buffer.getFloat(), buffer.getFloat(), buffer.getFloat(), buffer.getFloat()
+                        };
+                    }
+                } else {
+                    node.data = getString(buffer);
+                }
+                nodes.add(node);
+            }
+            return nodes;
+        }
+
+        private static String getString(ByteBuffer buffer) {
+            final char[] chars = new char[buffer.getInt()];
+            buffer.asCharBuffer().get(chars);
+            buffer.position(buffer.position() + 2 * chars.length);
+            return new String(chars);
+        }
+
+        void assertElement(String expectedTagName, int expectedParent) {
+            assertEquals("Node type", Node.ELEMENT_NODE, nodeType);
+            assertEquals("Tag name", expectedTagName, tagName);
+            assertEquals("Parent of " + expectedTagName, expectedParent, parent);
+        }
+
+        void assertText(String expectedData, int expectedParent) {
+            assertEquals("Node type", Node.TEXT_NODE, nodeType);
+            assertEquals("Text", expectedData, data);
+            assertEquals("Parent of " + expectedData, expectedParent, parent);
+        }
+    }
+
     // helper methods
 
     private void verifyChildRemoved(Node parent,
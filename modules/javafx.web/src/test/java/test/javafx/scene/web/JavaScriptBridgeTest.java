@@ -25,6 +25,7 @@
 
 package test.javafx.scene.web;
 
+import com.sun.webkit.dom.JSObjectShim;
 import javafx.scene.web.WebEngine;
 import netscape.javascript.JSException;
 import netscape.javascript.JSObject;
@@ -665,6 +666,165 @@ public class JavaScriptBridgeTest extends TestBase {
          });
     }
 
+    public static class ArrayUpdater {
+        private final int[] array;
+        public ArrayUpdater(int[] array) {
+            this.array = array;
+        }
+        public void add(int index, int value) {
+            array[index] += value;
+        }
+    }
+
+    public @Test void testBridgeArrayJavaUpdateBetweenReads() throws InterruptedException {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            int[] array = new int[1000];
+            for (int i = 0; i < array.length; i++) {
+                array[i] = i;
+            }
+            bind("test", array);
+            bind("updater", new ArrayUpdater(array));
+            // Sequential reads first, then a Java call changing an element
+            // that has already been read and one that has not.
+            assertEquals(Integer.valueOf(190 + 10 + 1000 + 20 + 2000), web.executeScript(
+                    "var s = 0;" +
+                    "for (var i = 0; i < 20; i++) s += test[i];" +
+                    "updater.add(10, 1000);" +
+                    "updater.add(20, 2000);" +
+                    "s + test[10] + test[20]"));
+            // Changes made by Java between two scripts.
+            array[10] = -1;
+            array[500] = -2;
+            assertEquals(Integer.valueOf(-1), web.executeScript("test[10]"));
+            assertEquals(Integer.valueOf(-2), web.executeScript("test[500]"));
+        });
+    }
+
+    public @Test void testBridgeArrayReadsMixedWithJavaCalls() throws InterruptedException {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            int[] array = new int[1000];
+            for (int i = 0; i < array.length; i++) {
+                array[i] = i;
+            }
+            bind("test", array);
+            bind("updater", new ArrayUpdater(array));
+            // Each iteration changes the element read next.
+            assertEquals(Integer.valueOf(499500 + 999 * 1000), web.executeScript(
+                    "var s = 0;" +
+                    "for (var i = 0; i < test.length; i++) {" +
+                    "    s += test[i];" +
+                    "    if (i + 1 < test.length) updater.add(i + 1, 1000);" +
+                    "}" +
+                    "s"));
+            assertEquals(999 + 1000, array[999]);
+        });
+    }
+
+    public @Test void testBridgeArrayToTypedArray() throws InterruptedException {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            double[] doubles = new double[100000];
+            for (int i = 0; i < doubles.length; i++) {
+                doubles[i] = i * 0.5;
+            }
+            bind("doubles", doubles);
+            assertEquals("Float64Array", web.executeScript(
+                    "doubles.toTypedArray().constructor.name"));
+            assertEquals(Integer.valueOf(100000), web.executeScript(
+                    "doubles.toTypedArray().length"));
+            assertEquals("49999.5", web.executeScript(
+                    "String(doubles.toTypedArray()[99999])"));
+            assertEquals(Boolean.TRUE, web.executeScript(
+                    "var copy = doubles.toTypedArray(), same = true;" +
+                    "for (var i = 0; i < copy.length; i++) same = same && copy[i] === doubles[i];" +
+                    "same"));
+
+            // The copy is a snapshot, and writes to it do not reach Java
+            assertEquals("1", web.executeScript(
+                    "var snapshot = doubles.toTypedArray(); snapshot[2] = 42; String(doubles[2])"));
+            doubles[3] = -1;
+            assertEquals("1.5", web.executeScript("String(snapshot[3])"));
+            assertEquals("-1", web.executeScript("String(doubles.toTypedArray()[3])"));
+
+            bind("ints", new int[] { -1, 0, Integer.MAX_VALUE });
+            assertEquals("Int32Array:-1,0,2147483647", web.executeScript(
+                    "var t = ints.toTypedArray(); t.constructor.name + ':' + Array.from(t).join()"));
+            bind("bytes", new byte[] { -128, 127 });
+            assertEquals("Int8Array:-128,127", web.executeScript(
+                    "var t = bytes.toTypedArray(); t.constructor.name + ':' + Array.from(t).join()"));
+            bind("chars", new char[] { 'a', '\uffff' });
+            assertEquals("Uint16Array:97,65535", web.executeScript(
+                    "var t = chars.toTypedArray(); t.constructor.name + ':' + Array.from(t).join()"));
+            bind("longs", new long[] { -5, 1L << 40 });
+            assertEquals("Float64Array:-5,1099511627776", web.executeScript(
+                    "var t = longs.toTypedArray(); t.constructor.name + ':' + Array.from(t).join()"));
+            bind("booleans", new boolean[] { true, false });
+            assertEquals("Uint8Array:1,0", web.executeScript(
+                    "var t = booleans.toTypedArray(); t.constructor.name + ':' + Array.from(t).join()"));
+
+            // Not enumerable, and not available for arrays of objects
+            assertEquals(Boolean.FALSE, web.executeScript(
+                    "Object.keys(ints).indexOf('toTypedArray') >= 0"));
+            bind("strings", new String[] { "a" });
+            assertEquals(Boolean.TRUE, web.executeScript(
+                    "try { strings.toTypedArray(); false } catch (e) { e instanceof TypeError }"));
+        });
+    }
+
+    public @Test void testBatch() throws InterruptedException {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            JSObject obj = (JSObject) web.executeScript(
+                    "({ x: 'a', add: function(a, b) { return String(a + b); } })");
+            Object[] results = JSObjectShim.batch(obj,
+                    new int[] {
+                        JSObjectShim.BATCH_GET_MEMBER,
+                        JSObjectShim.BATCH_SET_MEMBER,
+                        JSObjectShim.BATCH_GET_MEMBER,
+                        JSObjectShim.BATCH_CALL,
+                        JSObjectShim.BATCH_CALL,
+                        JSObjectShim.BATCH_GET_MEMBER,
+                    },
+                    new String[] { "x", "x", "x", "add", "missing", "missing" },
+                    new Object[] {
+                        null, "b", null, new Object[] { 1, 2 }, new Object[0], null
+                    });
+            assertArrayEquals(new Object[] {
+                "a", null, "b", "3", "undefined", "undefined"
+            }, results);
+            assertEquals("b", obj.getMember("x"));
+
+            // The batch stops at the first exception
+            web.executeScript("var log = []; var thrower = {"
+                    + " fail: function() { log.push('fail'); throw new Error('boom'); },"
+                    + " next: function() { log.push('next'); } }");
+            JSObject thrower = (JSObject) web.executeScript("thrower");
+            try {
+                JSObjectShim.batch(thrower,
+                        new int[] { JSObjectShim.BATCH_CALL, JSObjectShim.BATCH_CALL },
+                        new String[] { "fail", "next" },
+                        new Object[] { new Object[0], new Object[0] });
+                fail("JSException expected but not thrown");
+            } catch (JSException ex) {
+                assertEquals("netscape.javascript.JSException: Error: boom", ex.toString());
+            }
+            assertEquals("fail", web.executeScript("log.join()"));
+
+            try {
+                JSObjectShim.batch(obj, new int[] { 3 },
+                        new String[] { "x" }, new Object[] { null });
+                fail("IllegalArgumentException expected but not thrown");
+            } catch (IllegalArgumentException ex) {
+            }
+        });
+    }
+
     public @Test void testBridgeBadOverloading() throws InterruptedException {
         final WebEngine web = getEngine();
 
@@ -34,12 +34,26 @@ import static org.junit.Assert.assertNotNull;
 import static org.junit.Assert.assertNull;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assume.assumeTrue;
+import com.sun.javafx.webkit.UIClientImplShim;
+import com.sun.webkit.WebPageShim;
+import java.io.ByteArrayOutputStream;
 import java.io.File;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.HashMap;
+import java.util.Map;
 import java.util.concurrent.Callable;
 import java.util.concurrent.CountDownLatch;
 import javafx.concurrent.Worker.State;
 import javafx.event.EventHandler;
 import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebEngineShim;
 import netscape.javascript.JSObject;
 import org.junit.Test;
 import org.w3c.dom.Document;
@@ -421,4 +435,157 @@ public class LoadTest extends TestBase {
         WebEngine web = getEngine();
         assertTrue("Load task completed successfully", getLoadState() == SUCCEEDED);
     }
+
+    /**
+     * Minimal HTTP/1.1 server for the XHR tests below. A GET returns
+     * {@code bodyOfLength(n)} for the path {@code /n}, a POST echoes the
+     * request body back.
+     */
+    private static final class EchoServer implements AutoCloseable {
+        private final ServerSocket serverSocket;
+        private final Thread thread;
+
+        EchoServer() throws IOException {
+            serverSocket = new ServerSocket(0, 50, InetAddress.getLoopbackAddress());
+            thread = new Thread(() -> {
+                while (!serverSocket.isClosed()) {
+                    try (Socket socket = serverSocket.accept()) {
+                        handle(socket.getInputStream(), socket.getOutputStream());
+                    } catch (IOException e) {
+                        // closed by the test, or the client went away
+                    }
+                }
+            }, "LoadTest EchoServer");
+            thread.setDaemon(true);
+            thread.start();
+        }
+
+        String url(String path) {
+            return "http://127.0.0.1:" + serverSocket.getLocalPort() + path;
+        }
+
+        @Override public void close() throws IOException {
+            serverSocket.close();
+        }
+
+        private static String readLine(InputStream in) throws IOException {
+            ByteArrayOutputStream line = new ByteArrayOutputStream();
+            int c;
+            while ((c = in.read()) != -1 && c != '\n') {
+                if (c != '\r') {
+                    line.write(c);
+                }
+            }
+            return line.toString(StandardCharsets.ISO_8859_1);
+        }
+
+        private static void handle(InputStream in, OutputStream out) throws IOException {
+            String[] requestLine = readLine(in).split(" ");
+            Map<String, String> headers = new HashMap<>();
+            for (String line = readLine(in); !line.isEmpty(); line = readLine(in)) {
+                int colon = line.indexOf(':');
+                headers.put(line.substring(0, colon).trim().toLowerCase(), line.substring(colon + 1).trim());
+            }
+
+            byte[] body;
+            if ("chunked".equalsIgnoreCase(headers.get("transfer-encoding"))) {
+                ByteArrayOutputStream chunks = new ByteArrayOutputStream();
+                for (int size; (size = Integer.parseInt(readLine(in).trim(), 16)) > 0; readLine(in)) {
+                    chunks.write(in.readNBytes(size));
+                }
+                readLine(in);
+                body = chunks.toByteArray();
+            } else {
+                body = in.readNBytes(Integer.parseInt(headers.getOrDefault("content-length", "0")));
+            }
+
+            byte[] response;
+            if ("GET".equals(requestLine[0])) {
+                response = bodyOfLength(Integer.parseInt(requestLine[1].substring(1)))
+                        .getBytes(StandardCharsets.US_ASCII);
+            } else if ("POST".equals(requestLine[0])) {
+                response = body;
+            } else {
+                response = new byte[0];
+            }
+            out.write(("HTTP/1.1 200 OK\r\n" +
+                    "Content-Type: text/plain\r\n" +
+                    "Access-Control-Allow-Origin: *\r\n" +
+                    "Access-Control-Allow-Methods: GET, POST\r\n" +
+                    "Access-Control-Allow-Headers: *\r\n" +
+                    "Content-Length: " + response.length + "\r\n" +
+                    "Connection: close\r\n\r\n").getBytes(StandardCharsets.ISO_8859_1));
+            out.write(response);
+            out.flush();
+        }
+    }
+
+    private static String bodyOfLength(int length) {
+        StringBuilder body = new StringBuilder(length);
+        for (int i = 0; i < length; i++) {
+            body.append((char) ('a' + i % 26));
+        }
+        return body.toString();
+    }
+
+    private static String synchronousXHR(String method, String url, String body) {
+        return "var xhr = new XMLHttpRequest();" +
+               "xhr.open('" + method + "', '" + url + "', false);" +
+               "xhr.send(" + body + ");" +
+               "xhr.status + ':' + xhr.responseText";
+    }
+
+    // The body spans several network buffers, each delivered to the
+    // synchronous loader as a separate chunk.
+    @Test public void testSynchronousXHRWithMultiChunkBody() throws Exception {
+        try (EchoServer server = new EchoServer()) {
+            loadContent("<html><body></body></html>");
+            final int length = 300 * 1024 + 17;
+            assertEquals("200:" + bodyOfLength(length),
+                    executeScript(synchronousXHR("GET", server.url("/" + length), "null")));
+        }
+    }
+
+    @Test public void testUploadBlobSlice() throws Exception {
+        try (EchoServer server = new EchoServer()) {
+            loadContent("<html><body></body></html>");
+            assertEquals("200:345678", executeScript(synchronousXHR("POST", server.url("/"),
+                    "new Blob(['0123456789abcdef']).slice(3, 9)")));
+            assertEquals("200:cdefghij", executeScript(synchronousXHR("POST", server.url("/"),
+                    "new Blob(['ab', new Blob(['cdef']), 'ghijkl']).slice(2, 10)")));
+        }
+    }
+
+    @Test public void testUploadFileRange() throws Exception {
+        final String content = bodyOfLength(200 * 1024);
+        final File file = File.createTempFile("LoadTest", ".txt");
+        file.deleteOnExit();
+        Files.writeString(file.toPath(), content);
+
+        try (EchoServer server = new EchoServer()) {
+            UIClientImplShim.test_setChooseFiles(new String[] { file.getAbsolutePath() });
+            loadContent("<script>" +
+                        "window.addEventListener('click', (e) => {" +
+                            "document.getElementById('file').click();" +
+                        "});" +
+                        "</script>" +
+                        "<body><input type='file' id='file'" +
+                        " onchange='window.file = event.target.files[0]; latch.countDown();'/></body>");
+            final CountDownLatch latch = new CountDownLatch(1);
+            submit(() -> {
+                final JSObject window = (JSObject) getEngine().executeScript("window");
+                window.setMember("latch", latch);
+                // A click anywhere opens the file chooser.
+                WebPageShim.click(WebEngineShim.getPage(getEngine()), 0, 0);
+            });
+            latch.await();
+
+            assertEquals("200:" + content.substring(100, 200), executeScript(
+                    synchronousXHR("POST", server.url("/"), "file.slice(100, 200)")));
+            assertEquals("200:" + content.substring(50000, 150000), executeScript(
+                    synchronousXHR("POST", server.url("/"), "file.slice(50000, 150000)")));
+            assertEquals("200:" + content.substring(0, 10) + content.substring(190000), executeScript(
+                    synchronousXHR("POST", server.url("/"), "new Blob([file.slice(0, 10), file.slice(190000)])")));
+        }
+    }
 }